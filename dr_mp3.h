@@ -58,6 +58,20 @@ Build Options
 
 #define DR_MP3_NO_SIMD
   Disable SIMD optimizations.
+
+#define DR_MP3_NO_THREADING
+  Disables the use of threads. The multithreaded APIs (those ending with `_mt`) will still be available, but will run on the calling thread. On POSIX
+  platforms the multithreaded APIs use pthreads which means you may need to link with `-lpthread` (or compile with `-pthread`) unless this is defined.
+
+#define DR_MP3_NO_AVX2
+  Disable the AVX2 versions of the synthesis filter, IMDCT and anti-aliasing butterflies. These are only compiled when the
+  compiler supports AVX2 intrinsics and are selected at run time. The SSE versions are used when this is defined.
+
+#define DR_MP3_NO_EMBEDDED_SCRATCH
+  Removes the scratch memory from `drmp3dec`, and therefore `drmp3`, which is only used while an MP3 frame is being decoded. This
+  shrinks each decoder by about 16KB, leaving only the state that needs to persist between frames. drmp3dec_decode_frame() and the
+  `drmp3` APIs will instead allocate the scratch memory on the stack while decoding. Use drmp3dec_decode_frame_with_scratch() to
+  supply it yourself, such as one instance per thread.
 */
 
 #ifndef dr_mp3_h
@@ -295,15 +309,28 @@ typedef struct
     float mdct_overlap[2][9*32], qmf_state[15*2*32];
     int reserv, free_format_bytes;
     drmp3_uint8 header[4], reserv_buf[511];
+#ifndef DR_MP3_NO_EMBEDDED_SCRATCH
     drmp3dec_scratch scratch;
+#endif
 } drmp3dec;
 
 /* Initializes a low level decoder. */
 DRMP3_API void drmp3dec_init(drmp3dec *dec);
 
-/* Reads a frame from a low level decoder. */
+/*
+Reads a frame from a low level decoder.
+
+With DR_MP3_NO_EMBEDDED_SCRATCH the decoder's scratch memory is allocated on the stack for the duration of the call.
+*/
 DRMP3_API int drmp3dec_decode_frame(drmp3dec *dec, const drmp3_uint8 *mp3, int mp3_bytes, void *pcm, drmp3dec_frame_info *info);
 
+/*
+Same as drmp3dec_decode_frame(), except the scratch memory used while decoding the frame is supplied by the caller. Nothing in the
+scratch memory needs to persist between calls, so a single instance can be shared between any number of decoders so long as they
+are not decoding at the same time, such as one instance per thread.
+*/
+DRMP3_API int drmp3dec_decode_frame_with_scratch(drmp3dec *dec, drmp3dec_scratch *scratch, const drmp3_uint8 *mp3, int mp3_bytes, void *pcm, drmp3dec_frame_info *info);
+
 /* Helper for converting between f32 and s16. */
 DRMP3_API void drmp3dec_f32_to_s16(const float *in, drmp3_int16 *out, size_t num_samples);
 
@@ -410,8 +437,10 @@ typedef struct
     drmp3_uint32 mp3FrameSampleRate;    /* The sample rate of the currently loaded MP3 frame. Internal use only. */
     drmp3_uint32 pcmFramesConsumedInMP3Frame;
     drmp3_uint32 pcmFramesRemainingInMP3Frame;
-    drmp3_uint8 pcmFrames[sizeof(float)*DRMP3_MAX_SAMPLES_PER_FRAME];  /* <-- Multipled by sizeof(float) to ensure there's enough room for DR_MP3_FLOAT_OUTPUT. */
+    drmp3_uint8 pcmFrames[sizeof(float)*DRMP3_MAX_SAMPLES_PER_FRAME];  /* <-- Multipled by sizeof(float) to ensure there's enough room for f32 samples. */
+    drmp3_uint32 pcmFramesFormat;       /* The format of the samples in pcmFrames. New MP3 frames are decoded straight to this format. Internal use only. */
     drmp3_uint64 currentPCMFrame;       /* The current PCM frame, globally. */
+    drmp3_bool32 isCurrentPCMFrameApproximate;  /* Set after drmp3_seek_to_pcm_frame_approximate() lands via the Xing/Info TOC, in which case currentPCMFrame is only an estimate. */
     drmp3_uint64 streamCursor;          /* The current byte the decoder is sitting on in the raw stream. */
     drmp3_uint64 streamLength;          /* The length of the stream in bytes. dr_mp3 will not read beyond this. If a ID3v1 or APE tag is present, this will be set to the first byte of the tag. */
     drmp3_uint64 streamStartOffset;     /* The offset of the start of the MP3 data. This is used for skipping ID3v2 and VBR tags. */
@@ -422,6 +451,9 @@ typedef struct
     drmp3_uint64 totalPCMFrameCount;    /* Set to DRMP3_UINT64_MAX if the length is unknown. Includes delay and padding. */
     drmp3_bool32 isVBR;
     drmp3_bool32 isCBR;
+    drmp3_uint64 xingTOCStreamOffset;   /* The offset of the Xing/Info frame. Positions in xingTOC are relative to this. */
+    drmp3_uint64 xingTOCStreamSize;     /* The number of bytes covered by xingTOC. Set to 0 if the stream does not have a usable Xing/Info TOC. */
+    drmp3_uint8 xingTOC[100];           /* Entry i is the byte position of i% of the stream's duration, scaled to 0..256 of xingTOCStreamSize. */
     size_t dataSize;
     size_t dataCapacity;
     size_t dataConsumed;
@@ -503,6 +535,14 @@ Note that this is _not_ an MP3 frame, but rather a PCM frame.
 */
 DRMP3_API drmp3_bool32 drmp3_seek_to_pcm_frame(drmp3* pMP3, drmp3_uint64 frameIndex);
 
+/*
+Same as drmp3_seek_to_pcm_frame(), except that if no seek table has been bound and the stream has a Xing/Info tag with a TOC, the
+TOC will be used to jump close to the target frame. This is fast, but only approximate because of the limited resolution of the
+TOC. After seeking, the next PCM frame read may not be exactly frameIndex. Use drmp3_seek_to_pcm_frame() if you need sample-exact
+seeking.
+*/
+DRMP3_API drmp3_bool32 drmp3_seek_to_pcm_frame_approximate(drmp3* pMP3, drmp3_uint64 frameIndex);
+
 /*
 Calculates the total number of PCM frames in the MP3 stream. Cannot be used for infinite streams such as internet
 radio. Runs in linear time. Returns 0 on error.
@@ -517,14 +557,15 @@ DRMP3_API drmp3_uint64 drmp3_get_mp3_frame_count(drmp3* pMP3);
 
 /*
 Calculates the total number of MP3 and PCM frames in the MP3 stream. Cannot be used for infinite streams such as internet
-radio. Runs in linear time. Returns 0 on error.
+radio. Runs in linear time, but does not decode any audio. Returns 0 on error.
 
 This is equivalent to calling drmp3_get_mp3_frame_count() and drmp3_get_pcm_frame_count() except that it's more efficient.
 */
 DRMP3_API drmp3_bool32 drmp3_get_mp3_and_pcm_frame_count(drmp3* pMP3, drmp3_uint64* pMP3FrameCount, drmp3_uint64* pPCMFrameCount);
 
 /*
-Calculates the seekpoints based on PCM frames. This is slow.
+Calculates the seekpoints based on PCM frames. This needs to scan the entire stream, but MP3 frames are not decoded - only
+the header and side info of each frame is parsed so this is mostly bound by I/O.
 
 pSeekpoint count is a pointer to a uint32 containing the seekpoint count. On input it contains the desired count.
 On output it contains the actual count. The reason for this design is that the client may request too many
@@ -563,6 +604,32 @@ DRMP3_API float* drmp3_open_file_and_read_pcm_frames_f32(const char* filePath, d
 DRMP3_API drmp3_int16* drmp3_open_file_and_read_pcm_frames_s16(const char* filePath, drmp3_config* pConfig, drmp3_uint64* pTotalFrameCount, const drmp3_allocation_callbacks* pAllocationCallbacks);
 #endif
 
+/*
+Multithreaded versions of the APIs above. These split the stream into segments and decode each segment on its own thread, straight
+into a single output buffer. The output is identical to that of the single threaded versions.
+
+MP3 frames depend on the frames before them through the bit reservoir and the overlap of the synthesis filters. To account for this,
+each thread starts decoding a few MP3 frames before its segment and discards them. The segment boundaries and the number of these
+warm-up frames are determined by first scanning the headers of every MP3 frame in the stream, which is much faster than decoding.
+Each thread checks that it has landed on exactly the same MP3 frames as the scan and that its warm-up frames decoded successfully.
+If anything doesn't line up, or if the stream changes its channel count or sample rate part way through, these fall back to a
+single threaded decode.
+
+The file versions load the entire file into memory before decoding.
+
+Set threadCount to 0 to use one thread per logical CPU. Short streams will use fewer threads than requested. The allocation
+callbacks, if any, must be thread safe.
+
+If DR_MP3_NO_THREADING is defined, or threads are not supported on the target platform, decoding will be done on the calling thread.
+*/
+DRMP3_API float* drmp3_open_memory_and_read_pcm_frames_f32_mt(const void* pData, size_t dataSize, drmp3_uint32 threadCount, drmp3_config* pConfig, drmp3_uint64* pTotalFrameCount, const drmp3_allocation_callbacks* pAllocationCallbacks);
+DRMP3_API drmp3_int16* drmp3_open_memory_and_read_pcm_frames_s16_mt(const void* pData, size_t dataSize, drmp3_uint32 threadCount, drmp3_config* pConfig, drmp3_uint64* pTotalFrameCount, const drmp3_allocation_callbacks* pAllocationCallbacks);
+
+#ifndef DR_MP3_NO_STDIO
+DRMP3_API float* drmp3_open_file_and_read_pcm_frames_f32_mt(const char* filePath, drmp3_uint32 threadCount, drmp3_config* pConfig, drmp3_uint64* pTotalFrameCount, const drmp3_allocation_callbacks* pAllocationCallbacks);
+DRMP3_API drmp3_int16* drmp3_open_file_and_read_pcm_frames_s16_mt(const char* filePath, drmp3_uint32 threadCount, drmp3_config* pConfig, drmp3_uint64* pTotalFrameCount, const drmp3_allocation_callbacks* pAllocationCallbacks);
+#endif
+
 /*
 Allocates a block of memory on the heap.
 */
@@ -735,6 +802,47 @@ end:
     return g_have_simd - 1;
 #endif
 }
+#if !defined(DR_MP3_NO_AVX2) && ((defined(_MSC_VER) && _MSC_VER >= 1700 && !defined(__clang__)) || defined(__AVX2__))
+#include <immintrin.h>
+#define DRMP3_HAVE_AVX2 1
+#define DRMP3_V8STORE _mm256_storeu_ps
+#define DRMP3_V8LD _mm256_loadu_ps
+#define DRMP3_V8SET _mm256_set1_ps
+#define DRMP3_V8SET2(lo, hi) _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_set1_ps(lo)), _mm_set1_ps(hi), 1)
+#define DRMP3_V8ADD _mm256_add_ps
+#define DRMP3_V8SUB _mm256_sub_ps
+#define DRMP3_V8MUL _mm256_mul_ps
+#define DRMP3_V8MUL_S(x, s) _mm256_mul_ps(x, _mm256_set1_ps(s))
+#define DRMP3_V8REV(x) _mm256_permutevar8x32_ps(x, _mm256_setr_epi32(7, 6, 5, 4, 3, 2, 1, 0))
+typedef __m256 drmp3_f8;
+static int drmp3_have_avx2(void)
+{
+#if defined(__AVX2__)
+    return 1;
+#else
+    static int g_have_avx2;
+    int CPUInfo[4];
+    if (g_have_avx2)
+        goto end;
+    g_have_avx2 = 1;
+    drmp3_cpuid(CPUInfo, 0);
+    if (CPUInfo[0] >= 7)
+    {
+        drmp3_cpuid(CPUInfo, 1);
+        if ((CPUInfo[2] & (1 << 27)) && (_xgetbv(0) & 6) == 6) /* OSXSAVE, and the OS saves the YMM registers */
+        {
+            __cpuidex(CPUInfo, 7, 0);
+            g_have_avx2 = ((CPUInfo[1] >> 5) & 1) + 1; /* AVX2 */
+        }
+    }
+
+end:
+    return g_have_avx2 - 1;
+#endif
+}
+#else
+#define DRMP3_HAVE_AVX2 0
+#endif
 #elif defined(__ARM_NEON) || defined(__aarch64__) || defined(_M_ARM64) || defined(_M_ARM64EC)
 #include <arm_neon.h>
 #define DRMP3_HAVE_SSE 0
@@ -750,6 +858,7 @@ end:
 #define DRMP3_VMUL_S(x, s)  vmulq_f32(x, vmovq_n_f32(s))
 #define DRMP3_VREV(x) vcombine_f32(vget_high_f32(vrev64q_f32(x)), vget_low_f32(vrev64q_f32(x)))
 typedef float32x4_t drmp3_f4;
+#define DRMP3_HAVE_AVX2 0
 static int drmp3_have_simd(void)
 {   /* TODO: detect neon for !DR_MP3_ONLY_SIMD */
     return 1;
@@ -757,6 +866,7 @@ static int drmp3_have_simd(void)
 #else
 #define DRMP3_HAVE_SSE 0
 #define DRMP3_HAVE_SIMD 0
+#define DRMP3_HAVE_AVX2 0
 #ifdef DR_MP3_ONLY_SIMD
 #error DR_MP3_ONLY_SIMD used, but SSE/NEON not enabled
 #endif
@@ -765,6 +875,7 @@ static int drmp3_have_simd(void)
 #else
 
 #define DRMP3_HAVE_SIMD 0
+#define DRMP3_HAVE_AVX2 0
 
 #endif
 
@@ -1187,6 +1298,55 @@ static int drmp3_L3_read_side_info(drmp3_bs *bs, drmp3_L3_gr_info *gr, const drm
     return main_data_begin;
 }
 
+/*
+A cut down version of drmp3_L3_read_side_info() which only extracts main_data_begin and does the same validation. Used when
+scanning frames without decoding them.
+*/
+static int drmp3_L3_scan_side_info(drmp3_bs *bs, const drmp3_uint8 *hdr)
+{
+    int main_data_begin, part_23_sum = 0;
+    int gr_count = DRMP3_HDR_IS_MONO(hdr) ? 1 : 2;
+
+    if (DRMP3_HDR_TEST_MPEG1(hdr))
+    {
+        gr_count *= 2;
+        main_data_begin = drmp3_bs_get_bits(bs, 9);
+        bs->pos += 7 + gr_count;    /* scfsi */
+    } else
+    {
+        main_data_begin = drmp3_bs_get_bits(bs, 8 + gr_count) >> gr_count;
+    }
+
+    do
+    {
+        part_23_sum += drmp3_bs_get_bits(bs, 12);
+        if (drmp3_bs_get_bits(bs, 9) > 288)
+        {
+            return -1;
+        }
+        bs->pos += 8 + (DRMP3_HDR_TEST_MPEG1(hdr) ? 4 : 9);   /* global_gain, scalefac_compress */
+        if (drmp3_bs_get_bits(bs, 1))
+        {
+            if (!drmp3_bs_get_bits(bs, 2))
+            {
+                return -1;
+            }
+            bs->pos += 1 + 10 + 9;  /* mixed_block_flag, table_select, subblock_gain */
+        } else
+        {
+            bs->pos += 15 + 4 + 3;  /* table_select, region_count */
+        }
+        bs->pos += DRMP3_HDR_TEST_MPEG1(hdr) ? 3 : 2;  /* preflag, scalefac_scale, count1_table */
+    } while(--gr_count);
+
+    if (part_23_sum + bs->pos > bs->limit + main_data_begin*8)
+    {
+        return -1;
+    }
+
+    return main_data_begin;
+}
+
 static void drmp3_L3_read_scalefactors(drmp3_uint8 *scf, drmp3_uint8 *ist_pos, const drmp3_uint8 *scf_size, const drmp3_uint8 *scf_count, drmp3_bs *bitbuf, int scfsi)
 {
     int i, k;
@@ -1611,6 +1771,20 @@ static void drmp3_L3_antialias(float *grbuf, int nbands)
     for (; nbands > 0; nbands--, grbuf += 18)
     {
         int i = 0;
+#if DRMP3_HAVE_AVX2
+        if (drmp3_have_avx2())
+        {
+            drmp3_f8 vu = DRMP3_V8LD(grbuf + 18);
+            drmp3_f8 vd = DRMP3_V8LD(grbuf + 10);
+            drmp3_f8 vc0 = DRMP3_V8LD(g_aa[0]);
+            drmp3_f8 vc1 = DRMP3_V8LD(g_aa[1]);
+            vd = DRMP3_V8REV(vd);
+            DRMP3_V8STORE(grbuf + 18, DRMP3_V8SUB(DRMP3_V8MUL(vu, vc0), DRMP3_V8MUL(vd, vc1)));
+            vd = DRMP3_V8ADD(DRMP3_V8MUL(vu, vc1), DRMP3_V8MUL(vd, vc0));
+            DRMP3_V8STORE(grbuf + 10, DRMP3_V8REV(vd));
+            i = 8;
+        }
+#endif
 #if DRMP3_HAVE_SIMD
         if (drmp3_have_simd()) for (; i < 8; i += 4)
         {
@@ -1705,6 +1879,24 @@ static void drmp3_L3_imdct36(float *grbuf, float *overlap, const float *window,
 
         i = 0;
 
+#if DRMP3_HAVE_AVX2
+        if (drmp3_have_avx2())
+        {
+            drmp3_f8 vovl = DRMP3_V8LD(overlap);
+            drmp3_f8 vc = DRMP3_V8LD(co);
+            drmp3_f8 vs = DRMP3_V8LD(si);
+            drmp3_f8 vr0 = DRMP3_V8LD(g_twid9);
+            drmp3_f8 vr1 = DRMP3_V8LD(g_twid9 + 9);
+            drmp3_f8 vw0 = DRMP3_V8LD(window);
+            drmp3_f8 vw1 = DRMP3_V8LD(window + 9);
+            drmp3_f8 vsum = DRMP3_V8ADD(DRMP3_V8MUL(vc, vr1), DRMP3_V8MUL(vs, vr0));
+            DRMP3_V8STORE(overlap, DRMP3_V8SUB(DRMP3_V8MUL(vc, vr0), DRMP3_V8MUL(vs, vr1)));
+            DRMP3_V8STORE(grbuf, DRMP3_V8SUB(DRMP3_V8MUL(vovl, vw0), DRMP3_V8MUL(vsum, vw1)));
+            vsum = DRMP3_V8ADD(DRMP3_V8MUL(vovl, vw1), DRMP3_V8MUL(vsum, vw0));
+            DRMP3_V8STORE(grbuf + 10, DRMP3_V8REV(vsum));
+            i = 8;
+        }
+#endif
 #if DRMP3_HAVE_SIMD
         if (drmp3_have_simd()) for (; i < 8; i += 4)
         {
@@ -1869,6 +2061,69 @@ static void drmp3d_DCT_II(float *grbuf, int n)
         10.19000816f,0.50060302f,0.50241929f,3.40760851f,0.50547093f,0.52249861f,2.05778098f,0.51544732f,0.56694406f,1.48416460f,0.53104258f,0.64682180f,1.16943991f,0.55310392f,0.78815460f,0.97256821f,0.58293498f,1.06067765f,0.83934963f,0.62250412f,1.72244716f,0.74453628f,0.67480832f,5.10114861f
     };
     int i, k = 0;
+#if DRMP3_HAVE_AVX2
+    if (drmp3_have_avx2()) for (; k + 8 <= n; k += 8)
+    {
+        drmp3_f8 t[4][8], *x;
+        float *y = grbuf + k;
+
+        for (x = t[0], i = 0; i < 8; i++, x++)
+        {
+            drmp3_f8 x0 = DRMP3_V8LD(&y[i*18]);
+            drmp3_f8 x1 = DRMP3_V8LD(&y[(15 - i)*18]);
+            drmp3_f8 x2 = DRMP3_V8LD(&y[(16 + i)*18]);
+            drmp3_f8 x3 = DRMP3_V8LD(&y[(31 - i)*18]);
+            drmp3_f8 t0 = DRMP3_V8ADD(x0, x3);
+            drmp3_f8 t1 = DRMP3_V8ADD(x1, x2);
+            drmp3_f8 t2 = DRMP3_V8MUL_S(DRMP3_V8SUB(x1, x2), g_sec[3*i + 0]);
+            drmp3_f8 t3 = DRMP3_V8MUL_S(DRMP3_V8SUB(x0, x3), g_sec[3*i + 1]);
+            x[0] = DRMP3_V8ADD(t0, t1);
+            x[8] = DRMP3_V8MUL_S(DRMP3_V8SUB(t0, t1), g_sec[3*i + 2]);
+            x[16] = DRMP3_V8ADD(t3, t2);
+            x[24] = DRMP3_V8MUL_S(DRMP3_V8SUB(t3, t2), g_sec[3*i + 2]);
+        }
+        for (x = t[0], i = 0; i < 4; i++, x += 8)
+        {
+            drmp3_f8 x0 = x[0], x1 = x[1], x2 = x[2], x3 = x[3], x4 = x[4], x5 = x[5], x6 = x[6], x7 = x[7], xt;
+            xt = DRMP3_V8SUB(x0, x7); x0 = DRMP3_V8ADD(x0, x7);
+            x7 = DRMP3_V8SUB(x1, x6); x1 = DRMP3_V8ADD(x1, x6);
+            x6 = DRMP3_V8SUB(x2, x5); x2 = DRMP3_V8ADD(x2, x5);
+            x5 = DRMP3_V8SUB(x3, x4); x3 = DRMP3_V8ADD(x3, x4);
+            x4 = DRMP3_V8SUB(x0, x3); x0 = DRMP3_V8ADD(x0, x3);
+            x3 = DRMP3_V8SUB(x1, x2); x1 = DRMP3_V8ADD(x1, x2);
+            x[0] = DRMP3_V8ADD(x0, x1);
+            x[4] = DRMP3_V8MUL_S(DRMP3_V8SUB(x0, x1), 0.70710677f);
+            x5 = DRMP3_V8ADD(x5, x6);
+            x6 = DRMP3_V8MUL_S(DRMP3_V8ADD(x6, x7), 0.70710677f);
+            x7 = DRMP3_V8ADD(x7, xt);
+            x3 = DRMP3_V8MUL_S(DRMP3_V8ADD(x3, x4), 0.70710677f);
+            x5 = DRMP3_V8SUB(x5, DRMP3_V8MUL_S(x7, 0.198912367f)); /* rotate by PI/8 */
+            x7 = DRMP3_V8ADD(x7, DRMP3_V8MUL_S(x5, 0.382683432f));
+            x5 = DRMP3_V8SUB(x5, DRMP3_V8MUL_S(x7, 0.198912367f));
+            x0 = DRMP3_V8SUB(xt, x6); xt = DRMP3_V8ADD(xt, x6);
+            x[1] = DRMP3_V8MUL_S(DRMP3_V8ADD(xt, x7), 0.50979561f);
+            x[2] = DRMP3_V8MUL_S(DRMP3_V8ADD(x4, x3), 0.54119611f);
+            x[3] = DRMP3_V8MUL_S(DRMP3_V8SUB(x0, x5), 0.60134488f);
+            x[5] = DRMP3_V8MUL_S(DRMP3_V8ADD(x0, x5), 0.89997619f);
+            x[6] = DRMP3_V8MUL_S(DRMP3_V8SUB(x4, x3), 1.30656302f);
+            x[7] = DRMP3_V8MUL_S(DRMP3_V8SUB(xt, x7), 2.56291556f);
+        }
+
+        /* Only whole groups of 8 columns are done here. The remaining columns are left to the 4-wide loop below. */
+        for (i = 0; i < 7; i++, y += 4*18)
+        {
+            drmp3_f8 s = DRMP3_V8ADD(t[3][i], t[3][i + 1]);
+            DRMP3_V8STORE(&y[0*18], t[0][i]);
+            DRMP3_V8STORE(&y[1*18], DRMP3_V8ADD(t[2][i], s));
+            DRMP3_V8STORE(&y[2*18], DRMP3_V8ADD(t[1][i], t[1][i + 1]));
+            DRMP3_V8STORE(&y[3*18], DRMP3_V8ADD(t[2][1 + i], s));
+        }
+        DRMP3_V8STORE(&y[0*18], t[0][7]);
+        DRMP3_V8STORE(&y[1*18], DRMP3_V8ADD(t[2][7], t[3][7]));
+        DRMP3_V8STORE(&y[2*18], t[1][7]);
+        DRMP3_V8STORE(&y[3*18], t[3][7]);
+    }
+#endif
 #if DRMP3_HAVE_SIMD
     if (drmp3_have_simd()) for (; k < n; k += 4)
     {
@@ -2018,8 +2273,17 @@ static void drmp3d_DCT_II(float *grbuf, int n)
 #endif
 }
 
+/* The output formats the synthesis filter can write to. Both are always compiled in and are selected per call. */
+#define DRMP3_FORMAT_S16    0
+#define DRMP3_FORMAT_F32    1
+
+#define DRMP3_FORMAT_SAMPLE_SIZE(format) ((format) == DRMP3_FORMAT_F32 ? sizeof(float) : sizeof(drmp3_int16))
+
 #ifndef DR_MP3_FLOAT_OUTPUT
-typedef drmp3_int16 drmp3d_sample_t;
+#define DRMP3_DEFAULT_FORMAT    DRMP3_FORMAT_S16
+#else
+#define DRMP3_DEFAULT_FORMAT    DRMP3_FORMAT_F32
+#endif
 
 static drmp3_int16 drmp3d_scale_pcm(float sample)
 {
@@ -2036,16 +2300,16 @@ static drmp3_int16 drmp3d_scale_pcm(float sample)
 #endif
     return s;
 }
-#else
-typedef float drmp3d_sample_t;
 
-static float drmp3d_scale_pcm(float sample)
+static DRMP3_INLINE void drmp3d_store_pcm(void *pcm, int index, float sample, int format)
 {
-    return sample*(1.f/32768.f);
+    if (format == DRMP3_FORMAT_F32)
+        ((float*)pcm)[index] = sample*(1.f/32768.f);
+    else
+        ((drmp3_int16*)pcm)[index] = drmp3d_scale_pcm(sample);
 }
-#endif
 
-static void drmp3d_synth_pair(drmp3d_sample_t *pcm, int nch, const float *z)
+static void drmp3d_synth_pair(void *pcm, int index, int nch, const float *z, int format)
 {
     float a;
     a  = (z[14*64] - z[    0]) * 29;
@@ -2056,7 +2320,7 @@ static void drmp3d_synth_pair(drmp3d_sample_t *pcm, int nch, const float *z)
     a += (z[ 5*64] + z[ 9*64]) * 6574;
     a += (z[ 8*64] - z[ 6*64]) * 37489;
     a +=  z[ 7*64]             * 75038;
-    pcm[0] = drmp3d_scale_pcm(a);
+    drmp3d_store_pcm(pcm, index, a, format);
 
     z += 2;
     a  = z[14*64] * 104;
@@ -2067,14 +2331,17 @@ static void drmp3d_synth_pair(drmp3d_sample_t *pcm, int nch, const float *z)
     a += z[ 4*64] * -45;
     a += z[ 2*64] * 146;
     a += z[ 0*64] * -5;
-    pcm[16*nch] = drmp3d_scale_pcm(a);
+    drmp3d_store_pcm(pcm, index + 16*nch, a, format);
 }
 
-static void drmp3d_synth(float *xl, drmp3d_sample_t *dstl, int nch, float *lins)
+static void drmp3d_synth(float *xl, void *pcm, int nch, float *lins, int format)
 {
     int i;
     float *xr = xl + 576*(nch - 1);
-    drmp3d_sample_t *dstr = dstl + (nch - 1);
+#if DRMP3_HAVE_SIMD
+    drmp3_int16 *dstl = (drmp3_int16*)pcm, *dstr = dstl + (nch - 1);
+    float *dstlf = (float*)pcm, *dstrf = dstlf + (nch - 1);
+#endif
 
     static const float g_win[] = {
         -1,26,-31,208,218,401,-519,2063,2000,4788,-5517,7134,5959,35640,-39336,74992,
@@ -2106,13 +2373,77 @@ static void drmp3d_synth(float *xl, drmp3d_sample_t *dstl, int nch, float *lins)
     zlin[4*31 + 2] = xl[1];
     zlin[4*31 + 3] = xr[1];
 
-    drmp3d_synth_pair(dstr, nch, lins + 4*15 + 1);
-    drmp3d_synth_pair(dstr + 32*nch, nch, lins + 4*15 + 64 + 1);
-    drmp3d_synth_pair(dstl, nch, lins + 4*15);
-    drmp3d_synth_pair(dstl + 32*nch, nch, lins + 4*15 + 64);
+    drmp3d_synth_pair(pcm, nch - 1, nch, lins + 4*15 + 1, format);
+    drmp3d_synth_pair(pcm, nch - 1 + 32*nch, nch, lins + 4*15 + 64 + 1, format);
+    drmp3d_synth_pair(pcm, 0, nch, lins + 4*15, format);
+    drmp3d_synth_pair(pcm, 32*nch, nch, lins + 4*15 + 64, format);
+
+    i = 14;
+#if DRMP3_HAVE_AVX2
+    /* Two rows at a time. The row for i - 1 is in the low half and the row for i is in the high half so the loads stay contiguous. */
+    if (drmp3_have_avx2()) for (; i >= 1; i -= 2)
+    {
+#define DRMP3_V8LOAD(k) drmp3_f8 w0 = DRMP3_V8SET2(w[16 + 2*k], w[2*k]); drmp3_f8 w1 = DRMP3_V8SET2(w[17 + 2*k], w[1 + 2*k]); drmp3_f8 vz = DRMP3_V8LD(&zlin[4*(i - 1) - 64*k]); drmp3_f8 vy = DRMP3_V8LD(&zlin[4*(i - 1) - 64*(15 - k)]);
+#define DRMP3_V8_0(k) { DRMP3_V8LOAD(k) b =                 DRMP3_V8ADD(DRMP3_V8MUL(vz, w1), DRMP3_V8MUL(vy, w0)) ; a =                 DRMP3_V8SUB(DRMP3_V8MUL(vz, w0), DRMP3_V8MUL(vy, w1));  }
+#define DRMP3_V8_1(k) { DRMP3_V8LOAD(k) b = DRMP3_V8ADD(b, DRMP3_V8ADD(DRMP3_V8MUL(vz, w1), DRMP3_V8MUL(vy, w0))); a = DRMP3_V8ADD(a, DRMP3_V8SUB(DRMP3_V8MUL(vz, w0), DRMP3_V8MUL(vy, w1))); }
+#define DRMP3_V8_2(k) { DRMP3_V8LOAD(k) b = DRMP3_V8ADD(b, DRMP3_V8ADD(DRMP3_V8MUL(vz, w1), DRMP3_V8MUL(vy, w0))); a = DRMP3_V8ADD(a, DRMP3_V8SUB(DRMP3_V8MUL(vy, w1), DRMP3_V8MUL(vz, w0))); }
+        drmp3_f8 a, b;
+        int j, r;
+        for (r = i; r >= i - 1; r--)
+        {
+            zlin[4*r]     = xl[18*(31 - r)];
+            zlin[4*r + 1] = xr[18*(31 - r)];
+            zlin[4*r + 2] = xl[1 + 18*(31 - r)];
+            zlin[4*r + 3] = xr[1 + 18*(31 - r)];
+            zlin[4*r + 64] = xl[1 + 18*(1 + r)];
+            zlin[4*r + 64 + 1] = xr[1 + 18*(1 + r)];
+            zlin[4*r - 64 + 2] = xl[18*(1 + r)];
+            zlin[4*r - 64 + 3] = xr[18*(1 + r)];
+        }
+
+        DRMP3_V8_0(0) DRMP3_V8_2(1) DRMP3_V8_1(2) DRMP3_V8_2(3) DRMP3_V8_1(4) DRMP3_V8_2(5) DRMP3_V8_1(6) DRMP3_V8_2(7)
+        w += 32;
 
+        if (format == DRMP3_FORMAT_S16)
+        {
+            static const drmp3_f4 g_max = { 32767.0f, 32767.0f, 32767.0f, 32767.0f };
+            static const drmp3_f4 g_min = { -32768.0f, -32768.0f, -32768.0f, -32768.0f };
+            __m256i pcm16 = _mm256_packs_epi32(_mm256_cvtps_epi32(_mm256_max_ps(_mm256_min_ps(a, _mm256_broadcast_ps(&g_max)), _mm256_broadcast_ps(&g_min))),
+                                               _mm256_cvtps_epi32(_mm256_max_ps(_mm256_min_ps(b, _mm256_broadcast_ps(&g_max)), _mm256_broadcast_ps(&g_min))));
+            for (j = 0, r = i - 1; j < 2; j++, r++)
+            {
+                __m128i pcm8 = (j == 0) ? _mm256_castsi256_si128(pcm16) : _mm256_extracti128_si256(pcm16, 1);
+                dstr[(15 - r)*nch] = (drmp3_int16)_mm_extract_epi16(pcm8, 1);
+                dstr[(17 + r)*nch] = (drmp3_int16)_mm_extract_epi16(pcm8, 5);
+                dstl[(15 - r)*nch] = (drmp3_int16)_mm_extract_epi16(pcm8, 0);
+                dstl[(17 + r)*nch] = (drmp3_int16)_mm_extract_epi16(pcm8, 4);
+                dstr[(47 - r)*nch] = (drmp3_int16)_mm_extract_epi16(pcm8, 3);
+                dstr[(49 + r)*nch] = (drmp3_int16)_mm_extract_epi16(pcm8, 7);
+                dstl[(47 - r)*nch] = (drmp3_int16)_mm_extract_epi16(pcm8, 2);
+                dstl[(49 + r)*nch] = (drmp3_int16)_mm_extract_epi16(pcm8, 6);
+            }
+        } else
+        {
+            a = DRMP3_V8MUL_S(a, 1.0f/32768.0f);
+            b = DRMP3_V8MUL_S(b, 1.0f/32768.0f);
+            for (j = 0, r = i - 1; j < 2; j++, r++)
+            {
+                drmp3_f4 a4 = (j == 0) ? _mm256_castps256_ps128(a) : _mm256_extractf128_ps(a, 1);
+                drmp3_f4 b4 = (j == 0) ? _mm256_castps256_ps128(b) : _mm256_extractf128_ps(b, 1);
+                _mm_store_ss(dstrf + (15 - r)*nch, _mm_shuffle_ps(a4, a4, _MM_SHUFFLE(1, 1, 1, 1)));
+                _mm_store_ss(dstrf + (17 + r)*nch, _mm_shuffle_ps(b4, b4, _MM_SHUFFLE(1, 1, 1, 1)));
+                _mm_store_ss(dstlf + (15 - r)*nch, _mm_shuffle_ps(a4, a4, _MM_SHUFFLE(0, 0, 0, 0)));
+                _mm_store_ss(dstlf + (17 + r)*nch, _mm_shuffle_ps(b4, b4, _MM_SHUFFLE(0, 0, 0, 0)));
+                _mm_store_ss(dstrf + (47 - r)*nch, _mm_shuffle_ps(a4, a4, _MM_SHUFFLE(3, 3, 3, 3)));
+                _mm_store_ss(dstrf + (49 + r)*nch, _mm_shuffle_ps(b4, b4, _MM_SHUFFLE(3, 3, 3, 3)));
+                _mm_store_ss(dstlf + (47 - r)*nch, _mm_shuffle_ps(a4, a4, _MM_SHUFFLE(2, 2, 2, 2)));
+                _mm_store_ss(dstlf + (49 + r)*nch, _mm_shuffle_ps(b4, b4, _MM_SHUFFLE(2, 2, 2, 2)));
+            }
+        }
+    }
+#endif
 #if DRMP3_HAVE_SIMD
-    if (drmp3_have_simd()) for (i = 14; i >= 0; i--)
+    if (drmp3_have_simd()) for (; i >= 0; i--)
     {
 #define DRMP3_VLOAD(k) drmp3_f4 w0 = DRMP3_VSET(*w++); drmp3_f4 w1 = DRMP3_VSET(*w++); drmp3_f4 vz = DRMP3_VLD(&zlin[4*i - 64*k]); drmp3_f4 vy = DRMP3_VLD(&zlin[4*i - 64*(15 - k)]);
 #define DRMP3_V0(k) { DRMP3_VLOAD(k) b =               DRMP3_VADD(DRMP3_VMUL(vz, w1), DRMP3_VMUL(vy, w0)) ; a =               DRMP3_VSUB(DRMP3_VMUL(vz, w0), DRMP3_VMUL(vy, w1));  }
@@ -2130,8 +2461,8 @@ static void drmp3d_synth(float *xl, drmp3d_sample_t *dstl, int nch, float *lins)
 
         DRMP3_V0(0) DRMP3_V2(1) DRMP3_V1(2) DRMP3_V2(3) DRMP3_V1(4) DRMP3_V2(5) DRMP3_V1(6) DRMP3_V2(7)
 
+        if (format == DRMP3_FORMAT_S16)
         {
-#ifndef DR_MP3_FLOAT_OUTPUT
 #if DRMP3_HAVE_SSE
             static const drmp3_f4 g_max = { 32767.0f, 32767.0f, 32767.0f, 32767.0f };
             static const drmp3_f4 g_min = { -32768.0f, -32768.0f, -32768.0f, -32768.0f };
@@ -2160,7 +2491,8 @@ static void drmp3d_synth(float *xl, drmp3d_sample_t *dstl, int nch, float *lins)
             vst1_lane_s16(dstl + (47 - i)*nch, pcma, 2);
             vst1_lane_s16(dstl + (49 + i)*nch, pcmb, 2);
 #endif
-#else
+        } else
+        {
         #if DRMP3_HAVE_SSE
             static const drmp3_f4 g_scale = { 1.0f/32768.0f, 1.0f/32768.0f, 1.0f/32768.0f, 1.0f/32768.0f };
         #else
@@ -2169,25 +2501,24 @@ static void drmp3d_synth(float *xl, drmp3d_sample_t *dstl, int nch, float *lins)
             a = DRMP3_VMUL(a, g_scale);
             b = DRMP3_VMUL(b, g_scale);
 #if DRMP3_HAVE_SSE
-            _mm_store_ss(dstr + (15 - i)*nch, _mm_shuffle_ps(a, a, _MM_SHUFFLE(1, 1, 1, 1)));
-            _mm_store_ss(dstr + (17 + i)*nch, _mm_shuffle_ps(b, b, _MM_SHUFFLE(1, 1, 1, 1)));
-            _mm_store_ss(dstl + (15 - i)*nch, _mm_shuffle_ps(a, a, _MM_SHUFFLE(0, 0, 0, 0)));
-            _mm_store_ss(dstl + (17 + i)*nch, _mm_shuffle_ps(b, b, _MM_SHUFFLE(0, 0, 0, 0)));
-            _mm_store_ss(dstr + (47 - i)*nch, _mm_shuffle_ps(a, a, _MM_SHUFFLE(3, 3, 3, 3)));
-            _mm_store_ss(dstr + (49 + i)*nch, _mm_shuffle_ps(b, b, _MM_SHUFFLE(3, 3, 3, 3)));
-            _mm_store_ss(dstl + (47 - i)*nch, _mm_shuffle_ps(a, a, _MM_SHUFFLE(2, 2, 2, 2)));
-            _mm_store_ss(dstl + (49 + i)*nch, _mm_shuffle_ps(b, b, _MM_SHUFFLE(2, 2, 2, 2)));
+            _mm_store_ss(dstrf + (15 - i)*nch, _mm_shuffle_ps(a, a, _MM_SHUFFLE(1, 1, 1, 1)));
+            _mm_store_ss(dstrf + (17 + i)*nch, _mm_shuffle_ps(b, b, _MM_SHUFFLE(1, 1, 1, 1)));
+            _mm_store_ss(dstlf + (15 - i)*nch, _mm_shuffle_ps(a, a, _MM_SHUFFLE(0, 0, 0, 0)));
+            _mm_store_ss(dstlf + (17 + i)*nch, _mm_shuffle_ps(b, b, _MM_SHUFFLE(0, 0, 0, 0)));
+            _mm_store_ss(dstrf + (47 - i)*nch, _mm_shuffle_ps(a, a, _MM_SHUFFLE(3, 3, 3, 3)));
+            _mm_store_ss(dstrf + (49 + i)*nch, _mm_shuffle_ps(b, b, _MM_SHUFFLE(3, 3, 3, 3)));
+            _mm_store_ss(dstlf + (47 - i)*nch, _mm_shuffle_ps(a, a, _MM_SHUFFLE(2, 2, 2, 2)));
+            _mm_store_ss(dstlf + (49 + i)*nch, _mm_shuffle_ps(b, b, _MM_SHUFFLE(2, 2, 2, 2)));
 #else
-            vst1q_lane_f32(dstr + (15 - i)*nch, a, 1);
-            vst1q_lane_f32(dstr + (17 + i)*nch, b, 1);
-            vst1q_lane_f32(dstl + (15 - i)*nch, a, 0);
-            vst1q_lane_f32(dstl + (17 + i)*nch, b, 0);
-            vst1q_lane_f32(dstr + (47 - i)*nch, a, 3);
-            vst1q_lane_f32(dstr + (49 + i)*nch, b, 3);
-            vst1q_lane_f32(dstl + (47 - i)*nch, a, 2);
-            vst1q_lane_f32(dstl + (49 + i)*nch, b, 2);
+            vst1q_lane_f32(dstrf + (15 - i)*nch, a, 1);
+            vst1q_lane_f32(dstrf + (17 + i)*nch, b, 1);
+            vst1q_lane_f32(dstlf + (15 - i)*nch, a, 0);
+            vst1q_lane_f32(dstlf + (17 + i)*nch, b, 0);
+            vst1q_lane_f32(dstrf + (47 - i)*nch, a, 3);
+            vst1q_lane_f32(dstrf + (49 + i)*nch, b, 3);
+            vst1q_lane_f32(dstlf + (47 - i)*nch, a, 2);
+            vst1q_lane_f32(dstlf + (49 + i)*nch, b, 2);
 #endif
-#endif /* DR_MP3_FLOAT_OUTPUT */
         }
     } else
 #endif
@@ -2213,19 +2544,19 @@ static void drmp3d_synth(float *xl, drmp3d_sample_t *dstl, int nch, float *lins)
 
         DRMP3_S0(0) DRMP3_S2(1) DRMP3_S1(2) DRMP3_S2(3) DRMP3_S1(4) DRMP3_S2(5) DRMP3_S1(6) DRMP3_S2(7)
 
-        dstr[(15 - i)*nch] = drmp3d_scale_pcm(a[1]);
-        dstr[(17 + i)*nch] = drmp3d_scale_pcm(b[1]);
-        dstl[(15 - i)*nch] = drmp3d_scale_pcm(a[0]);
-        dstl[(17 + i)*nch] = drmp3d_scale_pcm(b[0]);
-        dstr[(47 - i)*nch] = drmp3d_scale_pcm(a[3]);
-        dstr[(49 + i)*nch] = drmp3d_scale_pcm(b[3]);
-        dstl[(47 - i)*nch] = drmp3d_scale_pcm(a[2]);
-        dstl[(49 + i)*nch] = drmp3d_scale_pcm(b[2]);
+        drmp3d_store_pcm(pcm, nch - 1 + (15 - i)*nch, a[1], format);
+        drmp3d_store_pcm(pcm, nch - 1 + (17 + i)*nch, b[1], format);
+        drmp3d_store_pcm(pcm,           (15 - i)*nch, a[0], format);
+        drmp3d_store_pcm(pcm,           (17 + i)*nch, b[0], format);
+        drmp3d_store_pcm(pcm, nch - 1 + (47 - i)*nch, a[3], format);
+        drmp3d_store_pcm(pcm, nch - 1 + (49 + i)*nch, b[3], format);
+        drmp3d_store_pcm(pcm,           (47 - i)*nch, a[2], format);
+        drmp3d_store_pcm(pcm,           (49 + i)*nch, b[2], format);
     }
 #endif
 }
 
-static void drmp3d_synth_granule(float *qmf_state, float *grbuf, int nbands, int nch, drmp3d_sample_t *pcm, float *lins)
+static void drmp3d_synth_granule(float *qmf_state, float *grbuf, int nbands, int nch, void *pcm, float *lins, int format)
 {
     int i;
     for (i = 0; i < nch; i++)
@@ -2237,7 +2568,7 @@ static void drmp3d_synth_granule(float *qmf_state, float *grbuf, int nbands, int
 
     for (i = 0; i < nbands; i += 2)
     {
-        drmp3d_synth(grbuf + i, pcm + 32*nch*i, nch, lins + i*64);
+        drmp3d_synth(grbuf + i, DRMP3_OFFSET_PTR(pcm, DRMP3_FORMAT_SAMPLE_SIZE(format)*32*nch*i), nch, lins + i*64, format);
     }
 #ifndef DR_MP3_NONSTANDARD_BUT_LOGICAL
     if (nch == 1)
@@ -2267,11 +2598,75 @@ static int drmp3d_match_frame(const drmp3_uint8 *hdr, int mp3_bytes, int frame_b
     return 1;
 }
 
+/*
+Returns the offset of the first byte in [0, count) that could start a valid header, or count if there isn't one. A candidate is
+0xFF followed by a byte with the top three bits set, which drmp3_hdr_valid() requires of every header. Blocks without a candidate
+are skipped with a vector compare so junk, artwork and corrupt regions don't go through drmp3_hdr_valid() one byte at a time. At
+least DRMP3_HDR_SIZE - 1 bytes past count must be readable.
+*/
+static int drmp3d_find_sync(const drmp3_uint8 *mp3, int count)
+{
+    int i = 0;
+#if DRMP3_HAVE_SIMD
+#if DRMP3_HAVE_AVX2
+    if (drmp3_have_avx2())
+    {
+        const __m256i ff = _mm256_set1_epi8((char)0xFF), e0 = _mm256_set1_epi8((char)0xE0);
+        for (; i + 32 <= count; i += 32)
+        {
+            __m256i b0 = _mm256_loadu_si256((const __m256i*)(mp3 + i));
+            __m256i b1 = _mm256_loadu_si256((const __m256i*)(mp3 + i + 1));
+            __m256i m  = _mm256_and_si256(_mm256_cmpeq_epi8(b0, ff), _mm256_cmpeq_epi8(_mm256_and_si256(b1, e0), e0));
+            if (_mm256_movemask_epi8(m) != 0)
+                break;
+        }
+    }
+#endif
+    if (drmp3_have_simd())
+    {
+#if DRMP3_HAVE_SSE
+        const __m128i ff = _mm_set1_epi8((char)0xFF), e0 = _mm_set1_epi8((char)0xE0);
+        for (; i + 16 <= count; i += 16)
+        {
+            __m128i b0 = _mm_loadu_si128((const __m128i*)(mp3 + i));
+            __m128i b1 = _mm_loadu_si128((const __m128i*)(mp3 + i + 1));
+            __m128i m  = _mm_and_si128(_mm_cmpeq_epi8(b0, ff), _mm_cmpeq_epi8(_mm_and_si128(b1, e0), e0));
+            if (_mm_movemask_epi8(m) != 0)
+                break;
+        }
+#else
+        const uint8x16_t e0 = vdupq_n_u8(0xE0);
+        for (; i + 16 <= count; i += 16)
+        {
+            uint8x16_t b0 = vld1q_u8(mp3 + i);
+            uint8x16_t b1 = vld1q_u8(mp3 + i + 1);
+            uint8x16_t m  = vandq_u8(vceqq_u8(b0, vdupq_n_u8(0xFF)), vceqq_u8(vandq_u8(b1, e0), e0));
+            uint64x2_t m2 = vreinterpretq_u64_u8(m);
+            if ((vgetq_lane_u64(m2, 0) | vgetq_lane_u64(m2, 1)) != 0)
+                break;
+        }
+#endif
+    }
+#endif
+    for (; i < count; i++)
+    {
+        if (mp3[i] == 0xFF && (mp3[i + 1] & 0xE0) == 0xE0)
+            break;
+    }
+    return i;
+}
+
 static int drmp3d_find_frame(const drmp3_uint8 *mp3, int mp3_bytes, int *free_format_bytes, int *ptr_frame_bytes)
 {
     int i, k;
     for (i = 0; i < mp3_bytes - DRMP3_HDR_SIZE; i++, mp3++)
     {
+        int skip = drmp3d_find_sync(mp3, mp3_bytes - DRMP3_HDR_SIZE - i);
+        i   += skip;
+        mp3 += skip;
+        if (i >= mp3_bytes - DRMP3_HDR_SIZE)
+            break;
+
         if (drmp3_hdr_valid(mp3))
         {
             int frame_bytes = drmp3_hdr_frame_bytes(mp3, *free_format_bytes);
@@ -2310,7 +2705,12 @@ DRMP3_API void drmp3dec_init(drmp3dec *dec)
     dec->header[0] = 0;
 }
 
-DRMP3_API int drmp3dec_decode_frame(drmp3dec *dec, const drmp3_uint8 *mp3, int mp3_bytes, void *pcm, drmp3dec_frame_info *info)
+/*
+Same as drmp3dec_decode_frame_with_scratch(), except the format of the output samples is specified at run time with
+DRMP3_FORMAT_S16 or DRMP3_FORMAT_F32 rather than at compile time with DR_MP3_FLOAT_OUTPUT. The synthesis filter writes straight to
+the requested format so there is no intermediary conversion.
+*/
+static int drmp3dec_decode_frame_scratch(drmp3dec *dec, drmp3dec_scratch *scratch, const drmp3_uint8 *mp3, int mp3_bytes, void *pcm, drmp3dec_frame_info *info, int format)
 {
     int i = 0, igr, frame_size = 0, success = 1;
     const drmp3_uint8 *hdr;
@@ -2351,23 +2751,23 @@ DRMP3_API int drmp3dec_decode_frame(drmp3dec *dec, const drmp3_uint8 *mp3, int m
 
     if (info->layer == 3)
     {
-        int main_data_begin = drmp3_L3_read_side_info(bs_frame, dec->scratch.gr_info, hdr);
+        int main_data_begin = drmp3_L3_read_side_info(bs_frame, scratch->gr_info, hdr);
         if (main_data_begin < 0 || bs_frame->pos > bs_frame->limit)
         {
             drmp3dec_init(dec);
             return 0;
         }
-        success = drmp3_L3_restore_reservoir(dec, bs_frame, &dec->scratch, main_data_begin);
+        success = drmp3_L3_restore_reservoir(dec, bs_frame, scratch, main_data_begin);
         if (success && pcm != NULL)
         {
-            for (igr = 0; igr < (DRMP3_HDR_TEST_MPEG1(hdr) ? 2 : 1); igr++, pcm = DRMP3_OFFSET_PTR(pcm, sizeof(drmp3d_sample_t)*576*info->channels))
+            for (igr = 0; igr < (DRMP3_HDR_TEST_MPEG1(hdr) ? 2 : 1); igr++, pcm = DRMP3_OFFSET_PTR(pcm, DRMP3_FORMAT_SAMPLE_SIZE(format)*576*info->channels))
             {
-                DRMP3_ZERO_MEMORY(dec->scratch.grbuf[0], 576*2*sizeof(float));
-                drmp3_L3_decode(dec, &dec->scratch, dec->scratch.gr_info + igr*info->channels, info->channels);
-                drmp3d_synth_granule(dec->qmf_state, dec->scratch.grbuf[0], 18, info->channels, (drmp3d_sample_t*)pcm, dec->scratch.syn[0]);
+                DRMP3_ZERO_MEMORY(scratch->grbuf[0], 576*2*sizeof(float));
+                drmp3_L3_decode(dec, scratch, scratch->gr_info + igr*info->channels, info->channels);
+                drmp3d_synth_granule(dec->qmf_state, scratch->grbuf[0], 18, info->channels, pcm, scratch->syn[0], format);
             }
         }
-        drmp3_L3_save_reservoir(dec, &dec->scratch);
+        drmp3_L3_save_reservoir(dec, scratch);
     } else
     {
 #ifdef DR_MP3_ONLY_MP3
@@ -2381,16 +2781,16 @@ DRMP3_API int drmp3dec_decode_frame(drmp3dec *dec, const drmp3_uint8 *mp3, int m
 
         drmp3_L12_read_scale_info(hdr, bs_frame, sci);
 
-        DRMP3_ZERO_MEMORY(dec->scratch.grbuf[0], 576*2*sizeof(float));
+        DRMP3_ZERO_MEMORY(scratch->grbuf[0], 576*2*sizeof(float));
         for (i = 0, igr = 0; igr < 3; igr++)
         {
-            if (12 == (i += drmp3_L12_dequantize_granule(dec->scratch.grbuf[0] + i, bs_frame, sci, info->layer | 1)))
+            if (12 == (i += drmp3_L12_dequantize_granule(scratch->grbuf[0] + i, bs_frame, sci, info->layer | 1)))
             {
                 i = 0;
-                drmp3_L12_apply_scf_384(sci, sci->scf + igr, dec->scratch.grbuf[0]);
-                drmp3d_synth_granule(dec->qmf_state, dec->scratch.grbuf[0], 12, info->channels, (drmp3d_sample_t*)pcm, dec->scratch.syn[0]);
-                DRMP3_ZERO_MEMORY(dec->scratch.grbuf[0], 576*2*sizeof(float));
-                pcm = DRMP3_OFFSET_PTR(pcm, sizeof(drmp3d_sample_t)*384*info->channels);
+                drmp3_L12_apply_scf_384(sci, sci->scf + igr, scratch->grbuf[0]);
+                drmp3d_synth_granule(dec->qmf_state, scratch->grbuf[0], 12, info->channels, pcm, scratch->syn[0], format);
+                DRMP3_ZERO_MEMORY(scratch->grbuf[0], 576*2*sizeof(float));
+                pcm = DRMP3_OFFSET_PTR(pcm, DRMP3_FORMAT_SAMPLE_SIZE(format)*384*info->channels);
             }
             if (bs_frame->pos > bs_frame->limit)
             {
@@ -2404,6 +2804,97 @@ DRMP3_API int drmp3dec_decode_frame(drmp3dec *dec, const drmp3_uint8 *mp3, int m
     return success*drmp3_hdr_frame_samples(dec->header);
 }
 
+/* Decodes with the scratch memory embedded in the decoder, or a temporary on the stack if DR_MP3_NO_EMBEDDED_SCRATCH is defined. */
+static int drmp3dec_decode_frame_ex(drmp3dec *dec, const drmp3_uint8 *mp3, int mp3_bytes, void *pcm, drmp3dec_frame_info *info, int format)
+{
+#ifndef DR_MP3_NO_EMBEDDED_SCRATCH
+    return drmp3dec_decode_frame_scratch(dec, &dec->scratch, mp3, mp3_bytes, pcm, info, format);
+#else
+    drmp3dec_scratch scratch;
+    return drmp3dec_decode_frame_scratch(dec, &scratch, mp3, mp3_bytes, pcm, info, format);
+#endif
+}
+
+DRMP3_API int drmp3dec_decode_frame(drmp3dec *dec, const drmp3_uint8 *mp3, int mp3_bytes, void *pcm, drmp3dec_frame_info *info)
+{
+    return drmp3dec_decode_frame_ex(dec, mp3, mp3_bytes, pcm, info, DRMP3_DEFAULT_FORMAT);
+}
+
+DRMP3_API int drmp3dec_decode_frame_with_scratch(drmp3dec *dec, drmp3dec_scratch *scratch, const drmp3_uint8 *mp3, int mp3_bytes, void *pcm, drmp3dec_frame_info *info)
+{
+    DRMP3_ASSERT(scratch != NULL);
+    return drmp3dec_decode_frame_scratch(dec, scratch, mp3, mp3_bytes, pcm, info, DRMP3_DEFAULT_FORMAT);
+}
+
+/*
+Equivalent to drmp3dec_decode_frame() with a NULL output buffer, except that it only looks at the header and side info. The bit
+reservoir is tracked by size only so the decoder must be reinitialized with drmp3dec_init() before decoding audio again.
+*/
+static int drmp3dec_scan_frame(drmp3dec *dec, const drmp3_uint8 *mp3, int mp3_bytes, drmp3dec_frame_info *info)
+{
+    int i = 0, frame_size = 0, success = 1;
+    const drmp3_uint8 *hdr;
+
+    if (mp3_bytes > 4 && dec->header[0] == 0xff && drmp3_hdr_compare(dec->header, mp3))
+    {
+        frame_size = drmp3_hdr_frame_bytes(mp3, dec->free_format_bytes) + drmp3_hdr_padding(mp3);
+        if (frame_size != mp3_bytes && (frame_size + DRMP3_HDR_SIZE > mp3_bytes || !drmp3_hdr_compare(mp3, mp3 + frame_size)))
+        {
+            frame_size = 0;
+        }
+    }
+    if (!frame_size)
+    {
+        dec->header[0] = 0;
+        dec->reserv = 0;
+        dec->free_format_bytes = 0;
+        i = drmp3d_find_frame(mp3, mp3_bytes, &dec->free_format_bytes, &frame_size);
+        if (!frame_size || i + frame_size > mp3_bytes)
+        {
+            info->frame_bytes = i;
+            return 0;
+        }
+    }
+
+    hdr = mp3 + i;
+    DRMP3_COPY_MEMORY(dec->header, hdr, DRMP3_HDR_SIZE);
+    info->frame_bytes = i + frame_size;
+    info->channels = DRMP3_HDR_IS_MONO(hdr) ? 1 : 2;
+    info->sample_rate = drmp3_hdr_sample_rate_hz(hdr);
+    info->layer = 4 - DRMP3_HDR_GET_LAYER(hdr);
+    info->bitrate_kbps = drmp3_hdr_bitrate_kbps(hdr);
+
+    if (info->layer == 3)
+    {
+        drmp3_bs bs_frame[1];
+        int main_data_begin;
+
+        drmp3_bs_init(bs_frame, hdr + DRMP3_HDR_SIZE, frame_size - DRMP3_HDR_SIZE);
+        if (DRMP3_HDR_IS_CRC(hdr))
+        {
+            drmp3_bs_get_bits(bs_frame, 16);
+        }
+
+        main_data_begin = drmp3_L3_scan_side_info(bs_frame, hdr);
+        if (main_data_begin < 0 || bs_frame->pos > bs_frame->limit)
+        {
+            drmp3dec_init(dec);
+            return 0;
+        }
+
+        /* This mirrors drmp3_L3_restore_reservoir() and drmp3_L3_save_reservoir() when nothing of the main data is consumed. */
+        success = dec->reserv >= main_data_begin;
+        dec->reserv = DRMP3_MIN(DRMP3_MIN(dec->reserv, main_data_begin) + (bs_frame->limit - bs_frame->pos)/8, DRMP3_MAX_BITRESERVOIR_BYTES);
+    } else
+    {
+#ifdef DR_MP3_ONLY_MP3
+        return 0;
+#endif
+    }
+
+    return success*drmp3_hdr_frame_samples(dec->header);
+}
+
 DRMP3_API void drmp3dec_f32_to_s16(const float *in, drmp3_int16 *out, size_t num_samples)
 {
     size_t i = 0;
@@ -2732,7 +3223,7 @@ static void drmp3__on_meta(drmp3* pMP3, drmp3_metadata_type type, const void* pR
 }
 
 
-static drmp3_uint32 drmp3_decode_next_frame_ex__callbacks(drmp3* pMP3, drmp3d_sample_t* pPCMFrames, drmp3dec_frame_info* pMP3FrameInfo, const drmp3_uint8** ppMP3FrameData)
+static drmp3_uint32 drmp3_decode_next_frame_ex__callbacks(drmp3* pMP3, void* pPCMFrames, drmp3dec_frame_info* pMP3FrameInfo, const drmp3_uint8** ppMP3FrameData, drmp3_bool32 scanOnly)
 {
     drmp3_uint32 pcmFramesRead = 0;
 
@@ -2796,7 +3287,11 @@ static drmp3_uint32 drmp3_decode_next_frame_ex__callbacks(drmp3* pMP3, drmp3d_sa
             return 0;
         }
 
-        pcmFramesRead = drmp3dec_decode_frame(&pMP3->decoder, pMP3->pData + pMP3->dataConsumed, (int)pMP3->dataSize, pPCMFrames, &info);    /* <-- Safe size_t -> int conversion thanks to the check above. */
+        if (scanOnly) {
+            pcmFramesRead = drmp3dec_scan_frame(&pMP3->decoder, pMP3->pData + pMP3->dataConsumed, (int)pMP3->dataSize, &info);
+        } else {
+            pcmFramesRead = drmp3dec_decode_frame_ex(&pMP3->decoder, pMP3->pData + pMP3->dataConsumed, (int)pMP3->dataSize, pPCMFrames, &info, (int)pMP3->pcmFramesFormat);    /* <-- Safe size_t -> int conversion thanks to the check above. */
+        }
 
         /* Consume the data. */
         pMP3->dataConsumed += (size_t)info.frame_bytes;
@@ -2857,7 +3352,7 @@ static drmp3_uint32 drmp3_decode_next_frame_ex__callbacks(drmp3* pMP3, drmp3d_sa
     return pcmFramesRead;
 }
 
-static drmp3_uint32 drmp3_decode_next_frame_ex__memory(drmp3* pMP3, drmp3d_sample_t* pPCMFrames, drmp3dec_frame_info* pMP3FrameInfo, const drmp3_uint8** ppMP3FrameData)
+static drmp3_uint32 drmp3_decode_next_frame_ex__memory(drmp3* pMP3, void* pPCMFrames, drmp3dec_frame_info* pMP3FrameInfo, const drmp3_uint8** ppMP3FrameData, drmp3_bool32 scanOnly)
 {
     drmp3_uint32 pcmFramesRead = 0;
     drmp3dec_frame_info info;
@@ -2870,7 +3365,11 @@ static drmp3_uint32 drmp3_decode_next_frame_ex__memory(drmp3* pMP3, drmp3d_sampl
     }
 
     for (;;) {
-        pcmFramesRead = drmp3dec_decode_frame(&pMP3->decoder, pMP3->memory.pData + pMP3->memory.currentReadPos, (int)(pMP3->memory.dataSize - pMP3->memory.currentReadPos), pPCMFrames, &info);
+        if (scanOnly) {
+            pcmFramesRead = drmp3dec_scan_frame(&pMP3->decoder, pMP3->memory.pData + pMP3->memory.currentReadPos, (int)(pMP3->memory.dataSize - pMP3->memory.currentReadPos), &info);
+        } else {
+            pcmFramesRead = drmp3dec_decode_frame_ex(&pMP3->decoder, pMP3->memory.pData + pMP3->memory.currentReadPos, (int)(pMP3->memory.dataSize - pMP3->memory.currentReadPos), pPCMFrames, &info, (int)pMP3->pcmFramesFormat);
+        }
         if (pcmFramesRead > 0) {
             pcmFramesRead = drmp3_hdr_frame_samples(pMP3->decoder.header);
             pMP3->pcmFramesConsumedInMP3Frame  = 0;
@@ -2904,19 +3403,33 @@ static drmp3_uint32 drmp3_decode_next_frame_ex__memory(drmp3* pMP3, drmp3d_sampl
     return pcmFramesRead;
 }
 
-static drmp3_uint32 drmp3_decode_next_frame_ex(drmp3* pMP3, drmp3d_sample_t* pPCMFrames, drmp3dec_frame_info* pMP3FrameInfo, const drmp3_uint8** ppMP3FrameData)
+static drmp3_uint32 drmp3_decode_next_frame_ex(drmp3* pMP3, void* pPCMFrames, drmp3dec_frame_info* pMP3FrameInfo, const drmp3_uint8** ppMP3FrameData)
+{
+    if (pMP3->memory.pData != NULL && pMP3->memory.dataSize > 0) {
+        return drmp3_decode_next_frame_ex__memory(pMP3, pPCMFrames, pMP3FrameInfo, ppMP3FrameData, DRMP3_FALSE);
+    } else {
+        return drmp3_decode_next_frame_ex__callbacks(pMP3, pPCMFrames, pMP3FrameInfo, ppMP3FrameData, DRMP3_FALSE);
+    }
+}
+
+/*
+Moves past the next MP3 frame by looking only at its header and side info. This is much faster than decoding, but it leaves the
+decoder in a state where it cannot be used for decoding until it's been reset. Only use this when counting frames or building
+seek points, and reset the decoder with drmp3_seek_to_start_of_stream() or similar when done.
+*/
+static drmp3_uint32 drmp3_scan_next_frame(drmp3* pMP3)
 {
     if (pMP3->memory.pData != NULL && pMP3->memory.dataSize > 0) {
-        return drmp3_decode_next_frame_ex__memory(pMP3, pPCMFrames, pMP3FrameInfo, ppMP3FrameData);
+        return drmp3_decode_next_frame_ex__memory(pMP3, NULL, NULL, NULL, DRMP3_TRUE);
     } else {
-        return drmp3_decode_next_frame_ex__callbacks(pMP3, pPCMFrames, pMP3FrameInfo, ppMP3FrameData);
+        return drmp3_decode_next_frame_ex__callbacks(pMP3, NULL, NULL, NULL, DRMP3_TRUE);
     }
 }
 
 static drmp3_uint32 drmp3_decode_next_frame(drmp3* pMP3)
 {
     DRMP3_ASSERT(pMP3 != NULL);
-    return drmp3_decode_next_frame_ex(pMP3, (drmp3d_sample_t*)pMP3->pcmFrames, NULL, NULL);
+    return drmp3_decode_next_frame_ex(pMP3, pMP3->pcmFrames, NULL, NULL);
 }
 
 #if 0
@@ -2971,6 +3484,12 @@ static drmp3_bool32 drmp3_init_internal(drmp3* pMP3, drmp3_read_proc onRead, drm
     pMP3->paddingInPCMFrames = 0;
     pMP3->totalPCMFrameCount = DRMP3_UINT64_MAX;
 
+    /*
+    Frames are decoded as f32 until the first read tells us what the client wants. f32 can be converted to s16 without any loss
+    compared to decoding as s16 in the first place, whereas the other way around cannot.
+    */
+    pMP3->pcmFramesFormat    = DRMP3_FORMAT_F32;
+
     /* We'll first check for any ID3v1 or APE tags. */
     #if 1
     if (onSeek != NULL && onTell != NULL) {
@@ -3156,7 +3675,7 @@ static drmp3_bool32 drmp3_init_internal(drmp3* pMP3, drmp3_read_proc onRead, drm
     Decode the first frame to confirm that it is indeed a valid MP3 stream. Note that it's possible the first frame
     is actually a Xing/LAME/VBRI header. If this is the case we need to skip over it.
     */
-    firstFramePCMFrameCount = drmp3_decode_next_frame_ex(pMP3, (drmp3d_sample_t*)pMP3->pcmFrames, &firstFrameInfo, &pFirstFrameData);
+    firstFramePCMFrameCount = drmp3_decode_next_frame_ex(pMP3, pMP3->pcmFrames, &firstFrameInfo, &pFirstFrameData);
     if (firstFramePCMFrameCount > 0) {
         DRMP3_ASSERT(pFirstFrameData != NULL);
 
@@ -3213,6 +3732,7 @@ static drmp3_bool32 drmp3_init_internal(drmp3* pMP3, drmp3_read_proc onRead, drm
                 if (isXing || isInfo) {
                     drmp3_uint32 bytes = 0;
                     drmp3_uint32 flags = pTagData[7];
+                    const drmp3_uint8* pTOC = NULL;
 
                     pTagData += 8;  /* Skip past the ID and flags. */
 
@@ -3231,7 +3751,6 @@ static drmp3_bool32 drmp3_init_internal(drmp3* pMP3, drmp3_read_proc onRead, drm
                         }
 
                         bytes  = (drmp3_uint32)pTagData[0] << 24 | (drmp3_uint32)pTagData[1] << 16 | (drmp3_uint32)pTagData[2] << 8 | (drmp3_uint32)pTagData[3];
-                        (void)bytes;    /* <-- Just to silence a warning about `bytes` being assigned but unused. Want to leave this here in case I want to make use of it later. */
                         pTagData += 4;
                     }
 
@@ -3240,7 +3759,7 @@ static drmp3_bool32 drmp3_init_internal(drmp3* pMP3, drmp3_read_proc onRead, drm
                             goto done_xing_info;    /* Invalid Xing/Info tag. */
                         }
 
-                        /* TODO: Extract and bind seek points. */
+                        pTOC = pTagData;
                         pTagData += 100;
                     }
 
@@ -3284,6 +3803,34 @@ static drmp3_bool32 drmp3_init_internal(drmp3* pMP3, drmp3_read_proc onRead, drm
                         pMP3->isCBR = DRMP3_TRUE;
                     }
 
+                    /*
+                    The TOC is used for approximate seeking when no seek table has been bound. It maps a percentage of the duration to a
+                    byte position relative to the start of this frame. When the BYTES field is missing we fall back to the length of the
+                    stream. The TOC is only usable if we also know the frame count since seeking is done in terms of PCM frames.
+                    */
+                    if (pTOC != NULL && detectedMP3FrameCount != 0xFFFFFFFF && detectedMP3FrameCount > 0) {
+                        drmp3_uint64 tocStreamSize = bytes;
+                        int iTOC;
+
+                        if (tocStreamSize == 0 && pMP3->streamLength != DRMP3_UINT64_MAX && pMP3->streamLength > pMP3->streamStartOffset) {
+                            tocStreamSize = pMP3->streamLength - pMP3->streamStartOffset;
+                        }
+
+                        /* The entries must be monotonically increasing. If they're not it's a malformed tag and we just ignore it. */
+                        for (iTOC = 1; iTOC < 100; iTOC += 1) {
+                            if (pTOC[iTOC] < pTOC[iTOC-1]) {
+                                tocStreamSize = 0;
+                                break;
+                            }
+                        }
+
+                        if (tocStreamSize > 0) {
+                            DRMP3_COPY_MEMORY(pMP3->xingTOC, pTOC, sizeof(pMP3->xingTOC));
+                            pMP3->xingTOCStreamOffset = pMP3->streamStartOffset;
+                            pMP3->xingTOCStreamSize   = tocStreamSize;
+                        }
+                    }
+
                     /* Post the raw data of the tag to the metadata callback. */
                     if (onMeta != NULL) {
                         drmp3_metadata_type metadataType = isXing ? DRMP3_METADATA_TYPE_XING : DRMP3_METADATA_TYPE_VBRI;
@@ -4136,71 +4683,57 @@ DRMP3_API void drmp3_uninit(drmp3* pMP3)
     drmp3__free_from_callbacks(pMP3->pData, &pMP3->allocationCallbacks);
 }
 
-#if defined(DR_MP3_FLOAT_OUTPUT)
-static void drmp3_f32_to_s16(drmp3_int16* dst, const float* src, drmp3_uint64 sampleCount)
+static void drmp3_s16_to_f32(float* dst, const drmp3_int16* src, drmp3_uint64 sampleCount)
 {
     drmp3_uint64 i;
-    drmp3_uint64 i4;
-    drmp3_uint64 sampleCount4;
-
-    /* Unrolled. */
-    i = 0;
-    sampleCount4 = sampleCount >> 2;
-    for (i4 = 0; i4 < sampleCount4; i4 += 1) {
-        float x0 = src[i+0];
-        float x1 = src[i+1];
-        float x2 = src[i+2];
-        float x3 = src[i+3];
-
-        x0 = ((x0 < -1) ? -1 : ((x0 > 1) ? 1 : x0));
-        x1 = ((x1 < -1) ? -1 : ((x1 > 1) ? 1 : x1));
-        x2 = ((x2 < -1) ? -1 : ((x2 > 1) ? 1 : x2));
-        x3 = ((x3 < -1) ? -1 : ((x3 > 1) ? 1 : x3));
-
-        x0 = x0 * 32767.0f;
-        x1 = x1 * 32767.0f;
-        x2 = x2 * 32767.0f;
-        x3 = x3 * 32767.0f;
+    for (i = 0; i < sampleCount; i += 1) {
+        float x = (float)src[i];
+        x = x * 0.000030517578125f;         /* -32768..32767 to -1..0.999969482421875 */
+        dst[i] = x;
+    }
+}
 
-        dst[i+0] = (drmp3_int16)x0;
-        dst[i+1] = (drmp3_int16)x1;
-        dst[i+2] = (drmp3_int16)x2;
-        dst[i+3] = (drmp3_int16)x3;
+/*
+Converts the MP3 frame sitting in pcmFrames to the given format. This only does anything when the client switches between the f32
+and s16 APIs part way through an MP3 frame. The whole frame is converted, not just the remaining part, so that f32 -> s16 goes down
+the same path as every other sample and ends up identical to what decoding straight to s16 would have produced.
+*/
+static void drmp3_convert_cached_pcm_frames(drmp3* pMP3, drmp3_uint32 format)
+{
+    drmp3_int16 pTempS16[DRMP3_MAX_SAMPLES_PER_FRAME];
+    size_t sampleCount;
 
-        i += 4;
+    if (pMP3->pcmFramesFormat == format) {
+        return;
     }
 
-    /* Leftover. */
-    for (; i < sampleCount; i += 1) {
-        float x = src[i];
-        x = ((x < -1) ? -1 : ((x > 1) ? 1 : x));    /* clip */
-        x = x * 32767.0f;                           /* -1..1 to -32767..32767 */
+    if (pMP3->pcmFramesRemainingInMP3Frame > 0) {
+        sampleCount = (size_t)(pMP3->pcmFramesConsumedInMP3Frame + pMP3->pcmFramesRemainingInMP3Frame) * pMP3->mp3FrameChannels;
+        DRMP3_ASSERT(sampleCount <= DRMP3_COUNTOF(pTempS16));
 
-        dst[i] = (drmp3_int16)x;
+        if (format == DRMP3_FORMAT_S16) {
+            drmp3dec_f32_to_s16((const float*)pMP3->pcmFrames, pTempS16, sampleCount);
+            DRMP3_COPY_MEMORY(pMP3->pcmFrames, pTempS16, sizeof(drmp3_int16) * sampleCount);
+        } else {
+            DRMP3_COPY_MEMORY(pTempS16, pMP3->pcmFrames, sizeof(drmp3_int16) * sampleCount);
+            drmp3_s16_to_f32((float*)pMP3->pcmFrames, pTempS16, sampleCount);
+        }
     }
-}
-#endif
 
-#if !defined(DR_MP3_FLOAT_OUTPUT)
-static void drmp3_s16_to_f32(float* dst, const drmp3_int16* src, drmp3_uint64 sampleCount)
-{
-    drmp3_uint64 i;
-    for (i = 0; i < sampleCount; i += 1) {
-        float x = (float)src[i];
-        x = x * 0.000030517578125f;         /* -32768..32767 to -1..0.999969482421875 */
-        dst[i] = x;
-    }
+    pMP3->pcmFramesFormat = format;
 }
-#endif
-
 
-static drmp3_uint64 drmp3_read_pcm_frames_raw(drmp3* pMP3, drmp3_uint64 framesToRead, void* pBufferOut)
+static drmp3_uint64 drmp3_read_pcm_frames_raw(drmp3* pMP3, drmp3_uint64 framesToRead, void* pBufferOut, drmp3_uint32 format)
 {
     drmp3_uint64 totalFramesRead = 0;
+    size_t bytesPerSample = DRMP3_FORMAT_SAMPLE_SIZE(format);
 
     DRMP3_ASSERT(pMP3 != NULL);
     DRMP3_ASSERT(pMP3->onRead != NULL);
 
+    /* Subsequent MP3 frames will be decoded straight to the requested format. Only the current one might need converting. */
+    drmp3_convert_cached_pcm_frames(pMP3, format);
+
     while (framesToRead > 0) {
         drmp3_uint32 framesToConsume;
 
@@ -4229,21 +4762,9 @@ static drmp3_uint64 drmp3_read_pcm_frames_raw(drmp3* pMP3, drmp3_uint64 framesTo
         }
 
         if (pBufferOut != NULL) {
-            #if defined(DR_MP3_FLOAT_OUTPUT)
-            {
-                /* f32 */
-                float* pFramesOutF32 = (float*)DRMP3_OFFSET_PTR(pBufferOut,          sizeof(float) * totalFramesRead                   * pMP3->channels);
-                float* pFramesInF32  = (float*)DRMP3_OFFSET_PTR(&pMP3->pcmFrames[0], sizeof(float) * pMP3->pcmFramesConsumedInMP3Frame * pMP3->mp3FrameChannels);
-                DRMP3_COPY_MEMORY(pFramesOutF32, pFramesInF32, sizeof(float) * framesToConsume * pMP3->channels);
-            }
-            #else
-            {
-                /* s16 */
-                drmp3_int16* pFramesOutS16 = (drmp3_int16*)DRMP3_OFFSET_PTR(pBufferOut,          sizeof(drmp3_int16) * totalFramesRead                   * pMP3->channels);
-                drmp3_int16* pFramesInS16  = (drmp3_int16*)DRMP3_OFFSET_PTR(&pMP3->pcmFrames[0], sizeof(drmp3_int16) * pMP3->pcmFramesConsumedInMP3Frame * pMP3->mp3FrameChannels);
-                DRMP3_COPY_MEMORY(pFramesOutS16, pFramesInS16, sizeof(drmp3_int16) * framesToConsume * pMP3->channels);
-            }
-            #endif
+            void* pFramesOut = DRMP3_OFFSET_PTR(pBufferOut,          bytesPerSample * totalFramesRead                   * pMP3->channels);
+            void* pFramesIn  = DRMP3_OFFSET_PTR(&pMP3->pcmFrames[0], bytesPerSample * pMP3->pcmFramesConsumedInMP3Frame * pMP3->mp3FrameChannels);
+            DRMP3_COPY_MEMORY(pFramesOut, pFramesIn, bytesPerSample * framesToConsume * pMP3->channels);
         }
 
         pMP3->currentPCMFrame              += framesToConsume;
@@ -4279,35 +4800,7 @@ DRMP3_API drmp3_uint64 drmp3_read_pcm_frames_f32(drmp3* pMP3, drmp3_uint64 frame
         return 0;
     }
 
-#if defined(DR_MP3_FLOAT_OUTPUT)
-    /* Fast path. No conversion required. */
-    return drmp3_read_pcm_frames_raw(pMP3, framesToRead, pBufferOut);
-#else
-    /* Slow path. Convert from s16 to f32. */
-    {
-        drmp3_int16 pTempS16[1152*2];   /* MP3 frames have a maximum per-channel sample count of 1152. Times 2 to account for stereo. */
-        drmp3_uint64 totalPCMFramesRead = 0;
-
-        while (totalPCMFramesRead < framesToRead) {
-            drmp3_uint64 framesJustRead;
-            drmp3_uint64 framesRemaining = framesToRead - totalPCMFramesRead;
-            drmp3_uint64 framesToReadNow = DRMP3_COUNTOF(pTempS16) / pMP3->channels;
-            if (framesToReadNow > framesRemaining) {
-                framesToReadNow = framesRemaining;
-            }
-
-            framesJustRead = drmp3_read_pcm_frames_raw(pMP3, framesToReadNow, pTempS16);
-            if (framesJustRead == 0) {
-                break;
-            }
-
-            drmp3_s16_to_f32((float*)DRMP3_OFFSET_PTR(pBufferOut, sizeof(float) * totalPCMFramesRead * pMP3->channels), pTempS16, framesJustRead * pMP3->channels);
-            totalPCMFramesRead += framesJustRead;
-        }
-
-        return totalPCMFramesRead;
-    }
-#endif
+    return drmp3_read_pcm_frames_raw(pMP3, framesToRead, pBufferOut, DRMP3_FORMAT_F32);
 }
 
 DRMP3_API drmp3_uint64 drmp3_read_pcm_frames_s16(drmp3* pMP3, drmp3_uint64 framesToRead, drmp3_int16* pBufferOut)
@@ -4316,35 +4809,7 @@ DRMP3_API drmp3_uint64 drmp3_read_pcm_frames_s16(drmp3* pMP3, drmp3_uint64 frame
         return 0;
     }
 
-#if !defined(DR_MP3_FLOAT_OUTPUT)
-    /* Fast path. No conversion required. */
-    return drmp3_read_pcm_frames_raw(pMP3, framesToRead, pBufferOut);
-#else
-    /* Slow path. Convert from f32 to s16. */
-    {
-        float pTempF32[1152*2];   /* MP3 frames have a maximum per-channel sample count of 1152. Times 2 to account for stereo. */
-        drmp3_uint64 totalPCMFramesRead = 0;
-
-        while (totalPCMFramesRead < framesToRead) {
-            drmp3_uint64 framesJustRead;
-            drmp3_uint64 framesRemaining = framesToRead - totalPCMFramesRead;
-            drmp3_uint64 framesToReadNow = DRMP3_COUNTOF(pTempF32) / pMP3->channels;
-            if (framesToReadNow > framesRemaining) {
-                framesToReadNow = framesRemaining;
-            }
-
-            framesJustRead = drmp3_read_pcm_frames_raw(pMP3, framesToReadNow, pTempF32);
-            if (framesJustRead == 0) {
-                break;
-            }
-
-            drmp3_f32_to_s16((drmp3_int16*)DRMP3_OFFSET_PTR(pBufferOut, sizeof(drmp3_int16) * totalPCMFramesRead * pMP3->channels), pTempF32, framesJustRead * pMP3->channels);
-            totalPCMFramesRead += framesJustRead;
-        }
-
-        return totalPCMFramesRead;
-    }
-#endif
+    return drmp3_read_pcm_frames_raw(pMP3, framesToRead, pBufferOut, DRMP3_FORMAT_S16);
 }
 
 static void drmp3_reset(drmp3* pMP3)
@@ -4353,7 +4818,9 @@ static void drmp3_reset(drmp3* pMP3)
 
     pMP3->pcmFramesConsumedInMP3Frame = 0;
     pMP3->pcmFramesRemainingInMP3Frame = 0;
+    pMP3->pcmFramesFormat = DRMP3_FORMAT_F32;  /* We don't know which format will be read after a seek. f32 can be converted to s16 losslessly. */
     pMP3->currentPCMFrame = 0;
+    pMP3->isCurrentPCMFrameApproximate = DRMP3_FALSE;
     pMP3->dataSize = 0;
     pMP3->atEnd = DRMP3_FALSE;
     drmp3dec_init(&pMP3->decoder);
@@ -4384,11 +4851,7 @@ static drmp3_bool32 drmp3_seek_forward_by_pcm_frames__brute_force(drmp3* pMP3, d
     frames without spending the time doing a full decode. I cannot see an easy way to do this in minimp3, however, so it may involve some
     kind of manual processing.
     */
-#if defined(DR_MP3_FLOAT_OUTPUT)
-    framesRead = drmp3_read_pcm_frames_f32(pMP3, frameOffset, NULL);
-#else
-    framesRead = drmp3_read_pcm_frames_s16(pMP3, frameOffset, NULL);
-#endif
+    framesRead = drmp3_read_pcm_frames_raw(pMP3, frameOffset, NULL, DRMP3_FORMAT_F32);
     if (framesRead != frameOffset) {
         return DRMP3_FALSE;
     }
@@ -4475,12 +4938,12 @@ static drmp3_bool32 drmp3_seek_to_pcm_frame__seek_table(drmp3* pMP3, drmp3_uint6
     /* Whole MP3 frames need to be discarded first. */
     for (iMP3Frame = 0; iMP3Frame < seekPoint.mp3FramesToDiscard; ++iMP3Frame) {
         drmp3_uint32 pcmFramesRead;
-        drmp3d_sample_t* pPCMFrames;
+        void* pPCMFrames;
 
         /* Pass in non-null for the last frame because we want to ensure the sample rate converter is preloaded correctly. */
         pPCMFrames = NULL;
         if (iMP3Frame == seekPoint.mp3FramesToDiscard-1) {
-            pPCMFrames = (drmp3d_sample_t*)pMP3->pcmFrames;
+            pPCMFrames = pMP3->pcmFrames;
         }
 
         /* We first need to decode the next frame. */
@@ -4501,22 +4964,209 @@ static drmp3_bool32 drmp3_seek_to_pcm_frame__seek_table(drmp3* pMP3, drmp3_uint6
     return drmp3_seek_forward_by_pcm_frames__brute_force(pMP3, leftoverFrames);
 }
 
-DRMP3_API drmp3_bool32 drmp3_seek_to_pcm_frame(drmp3* pMP3, drmp3_uint64 frameIndex)
+static drmp3_uint64 drmp3_xing_toc_percent_to_byte(const drmp3* pMP3, double percent)
 {
-    if (pMP3 == NULL || pMP3->onSeek == NULL) {
+    int iTOC;
+    double a;
+    double b;
+
+    if (percent < 0) {
+        percent = 0;
+    }
+    if (percent > 99.999) {
+        percent = 99.999;
+    }
+
+    iTOC = (int)percent;
+    a = pMP3->xingTOC[iTOC];
+    b = (iTOC < 99) ? pMP3->xingTOC[iTOC+1] : 256.0;
+
+    return pMP3->xingTOCStreamOffset + (drmp3_uint64)((a + (b - a)*(percent - iTOC)) * (1.0/256.0) * (double)pMP3->xingTOCStreamSize);
+}
+
+static double drmp3_xing_toc_byte_to_percent(const drmp3* pMP3, drmp3_uint64 bytePos)
+{
+    int iTOC;
+    double pos;
+
+    if (bytePos <= pMP3->xingTOCStreamOffset) {
+        return 0;
+    }
+
+    pos = (double)(bytePos - pMP3->xingTOCStreamOffset) * 256.0 / (double)pMP3->xingTOCStreamSize;
+
+    for (iTOC = 0; iTOC < 100; iTOC += 1) {
+        double a = pMP3->xingTOC[iTOC];
+        double b = (iTOC < 99) ? pMP3->xingTOC[iTOC+1] : 256.0;
+
+        if (pos < b) {
+            if (b > a) {
+                return iTOC + (pos - a) / (b - a);
+            } else {
+                return iTOC;
+            }
+        }
+    }
+
+    return 100;
+}
+
+static drmp3_bool32 drmp3_seek_to_pcm_frame__xing_toc(drmp3* pMP3, drmp3_uint64 frameIndex)
+{
+    drmp3_uint64 targetPCMFrame;
+    drmp3_uint64 backoffInPCMFrames;
+    drmp3_uint32 iAttempt;
+
+    DRMP3_ASSERT(pMP3 != NULL);
+    DRMP3_ASSERT(pMP3->xingTOCStreamSize > 0);
+    DRMP3_ASSERT(pMP3->totalPCMFrameCount != DRMP3_UINT64_MAX);
+
+    /*
+    The TOC only gives us an approximate byte position for a given percentage of the stream's duration. We jump to that position,
+    let the decoder resync, and then map the byte position of the frame it synced to back through the TOC to estimate the PCM frame
+    we landed on. From there it's just a read-and-discard of the remaining distance. The estimate is only as good as the TOC which
+    has a resolution of 1% of the duration and 1/256th of the size, so for sample-exact seeking a seek table needs to be bound.
+
+    The target frame is in terms of the raw stream which includes the encoder delay. This is consistent with the brute force path.
+    */
+    targetPCMFrame = frameIndex + pMP3->delayInPCMFrames;
+    if (pMP3->totalPCMFrameCount <= pMP3->paddingInPCMFrames || targetPCMFrame >= pMP3->totalPCMFrameCount - pMP3->paddingInPCMFrames) {
+        return drmp3_seek_to_pcm_frame__brute_force(pMP3, frameIndex);
+    }
+
+    /*
+    Aim a few MP3 frames before the target so there's room for priming the bit reservoir. Since the frame we sync to can be larger
+    than the average frame of that part of the stream, the estimate can land past the target. When that happens we just try again
+    further back.
+    */
+    backoffInPCMFrames = (DRMP3_SEEK_LEADING_MP3_FRAMES + 1) * DRMP3_MAX_PCM_FRAMES_PER_MP3_FRAME;
+
+    for (iAttempt = 0; iAttempt < 4; iAttempt += 1) {
+        drmp3_uint64 totalMP3FrameCount;
+        drmp3_uint64 landingMP3Frame;
+        drmp3_uint64 landingBytePos = 0;
+        drmp3_uint32 pcmFramesPerMP3Frame = 0;
+        drmp3_uint32 iMP3Frame;
+        double landingPercent;
+
+        if (backoffInPCMFrames >= targetPCMFrame) {
+            break;  /* Too close to the start. */
+        }
+
+        if (!drmp3__on_seek_64(pMP3, drmp3_xing_toc_percent_to_byte(pMP3, (double)(targetPCMFrame - backoffInPCMFrames) * 100.0 / (double)pMP3->totalPCMFrameCount), DRMP3_SEEK_SET)) {
+            return DRMP3_FALSE;
+        }
+
+        /* Clear any cached data. */
+        drmp3_reset(pMP3);
+
+        /* Decode the leading frames. The first one tells us where we landed. The last one is kept so it can be read from straight away. */
+        for (iMP3Frame = 0; iMP3Frame < DRMP3_SEEK_LEADING_MP3_FRAMES; ++iMP3Frame) {
+            drmp3_uint32 pcmFramesRead;
+            void* pPCMFrames;
+
+            pPCMFrames = NULL;
+            if (iMP3Frame == DRMP3_SEEK_LEADING_MP3_FRAMES-1) {
+                pPCMFrames = pMP3->pcmFrames;
+            }
+
+            pcmFramesRead = drmp3_decode_next_frame_ex(pMP3, pPCMFrames, NULL, NULL);
+            if (pcmFramesRead == 0) {
+                return DRMP3_FALSE;
+            }
+
+            if (iMP3Frame == 0) {
+                /* The frame_bytes property includes any bytes skipped while syncing so the size of the frame itself needs to come from the header. */
+                drmp3_uint64 frameSizeInBytes = (drmp3_uint64)(drmp3_hdr_frame_bytes(pMP3->decoder.header, pMP3->decoder.free_format_bytes) + drmp3_hdr_padding(pMP3->decoder.header));
+
+                DRMP3_ASSERT(pMP3->streamCursor >= pMP3->dataSize + frameSizeInBytes);
+                landingBytePos = pMP3->streamCursor - pMP3->dataSize - frameSizeInBytes;
+                pcmFramesPerMP3Frame = pcmFramesRead;
+            }
+        }
+
+        totalMP3FrameCount = pMP3->totalPCMFrameCount / pcmFramesPerMP3Frame;
+        landingPercent     = drmp3_xing_toc_byte_to_percent(pMP3, landingBytePos);
+        landingMP3Frame    = (drmp3_uint64)(landingPercent * (double)totalMP3FrameCount / 100.0 + 0.5);
+
+        /* The current PCM frame is that of the last leading frame which is still sitting in the cache. */
+        pMP3->currentPCMFrame = (landingMP3Frame + DRMP3_SEEK_LEADING_MP3_FRAMES-1) * pcmFramesPerMP3Frame;
+
+        /* If we landed inside the encoder delay, reading would skip frames behind our back. Just do it from the start. */
+        if (pMP3->currentPCMFrame < pMP3->delayInPCMFrames) {
+            break;
+        }
+
+        if (pMP3->currentPCMFrame <= targetPCMFrame) {
+            pMP3->isCurrentPCMFrameApproximate = DRMP3_TRUE;
+            return drmp3_seek_forward_by_pcm_frames__brute_force(pMP3, targetPCMFrame - pMP3->currentPCMFrame);
+        }
+
+        /* Overshot. Try again, backing off by twice the amount we overshot by. */
+        backoffInPCMFrames += (pMP3->currentPCMFrame - targetPCMFrame) * 2;
+    }
+
+    /* The TOC wasn't precise enough for this position so we need to fall back to the slow path. */
+    if (!drmp3_seek_to_start_of_stream(pMP3)) {
         return DRMP3_FALSE;
     }
 
+    return drmp3_seek_forward_by_pcm_frames__brute_force(pMP3, frameIndex);
+}
+
+static drmp3_bool32 drmp3_seek_to_pcm_frame__internal(drmp3* pMP3, drmp3_uint64 frameIndex, drmp3_bool32 allowApproximate)
+{
+    DRMP3_ASSERT(pMP3 != NULL);
+    DRMP3_ASSERT(pMP3->onSeek != NULL);
+
     if (frameIndex == 0) {
         return drmp3_seek_to_start_of_stream(pMP3);
     }
 
+    /*
+    After an approximate seek the current PCM frame is only an estimate, so an exact seek cannot read forward from it. The seek table
+    path is unaffected because it always seeks to an absolute position.
+    */
+    if (!allowApproximate && pMP3->isCurrentPCMFrameApproximate && (pMP3->pSeekPoints == NULL || pMP3->seekPointCount == 0)) {
+        if (!drmp3_seek_to_start_of_stream(pMP3)) {
+            return DRMP3_FALSE;
+        }
+    }
+
     /* Use the seek table if we have one. */
     if (pMP3->pSeekPoints != NULL && pMP3->seekPointCount > 0) {
         return drmp3_seek_to_pcm_frame__seek_table(pMP3, frameIndex);
-    } else {
-        return drmp3_seek_to_pcm_frame__brute_force(pMP3, frameIndex);
     }
+
+    /*
+    Fall back to the Xing/Info TOC if we have one. This is only approximate so it's not used for short forward seeks where reading
+    from the current position is cheap and exact. A single TOC entry covers 1% of the stream which is what we use as the threshold.
+    */
+    if (allowApproximate && pMP3->xingTOCStreamSize > 0 && pMP3->totalPCMFrameCount != DRMP3_UINT64_MAX) {
+        if (frameIndex < pMP3->currentPCMFrame || (frameIndex - pMP3->currentPCMFrame) > (pMP3->totalPCMFrameCount / 100)) {
+            return drmp3_seek_to_pcm_frame__xing_toc(pMP3, frameIndex);
+        }
+    }
+
+    return drmp3_seek_to_pcm_frame__brute_force(pMP3, frameIndex);
+}
+
+DRMP3_API drmp3_bool32 drmp3_seek_to_pcm_frame(drmp3* pMP3, drmp3_uint64 frameIndex)
+{
+    if (pMP3 == NULL || pMP3->onSeek == NULL) {
+        return DRMP3_FALSE;
+    }
+
+    return drmp3_seek_to_pcm_frame__internal(pMP3, frameIndex, DRMP3_FALSE);
+}
+
+DRMP3_API drmp3_bool32 drmp3_seek_to_pcm_frame_approximate(drmp3* pMP3, drmp3_uint64 frameIndex)
+{
+    if (pMP3 == NULL || pMP3->onSeek == NULL) {
+        return DRMP3_FALSE;
+    }
+
+    return drmp3_seek_to_pcm_frame__internal(pMP3, frameIndex, DRMP3_TRUE);
 }
 
 DRMP3_API drmp3_bool32 drmp3_get_mp3_and_pcm_frame_count(drmp3* pMP3, drmp3_uint64* pMP3FrameCount, drmp3_uint64* pPCMFrameCount)
@@ -4552,7 +5202,7 @@ DRMP3_API drmp3_bool32 drmp3_get_mp3_and_pcm_frame_count(drmp3* pMP3, drmp3_uint
     for (;;) {
         drmp3_uint32 pcmFramesInCurrentMP3Frame;
 
-        pcmFramesInCurrentMP3Frame = drmp3_decode_next_frame_ex(pMP3, NULL, NULL, NULL);
+        pcmFramesInCurrentMP3Frame = drmp3_scan_next_frame(pMP3);
         if (pcmFramesInCurrentMP3Frame == 0) {
             break;
         }
@@ -4561,12 +5211,12 @@ DRMP3_API drmp3_bool32 drmp3_get_mp3_and_pcm_frame_count(drmp3* pMP3, drmp3_uint
         totalMP3FrameCount += 1;
     }
 
-    /* Finally, we need to seek back to where we were. */
+    /* Finally, we need to seek back to where we were. This needs to be exact so the Xing/Info TOC must not be used. */
     if (!drmp3_seek_to_start_of_stream(pMP3)) {
         return DRMP3_FALSE;
     }
 
-    if (!drmp3_seek_to_pcm_frame(pMP3, currentPCMFrame)) {
+    if (!drmp3_seek_to_pcm_frame__internal(pMP3, currentPCMFrame, DRMP3_FALSE)) {
         return DRMP3_FALSE;
     }
 
@@ -4714,7 +5364,7 @@ DRMP3_API drmp3_bool32 drmp3_calculate_seek_points(drmp3* pMP3, drmp3_uint32* pS
             mp3FrameInfo[iMP3Frame].pcmFrameIndex = runningPCMFrameCount;
 
             /* We need to get information about this frame so we can know how many samples it contained. */
-            pcmFramesInCurrentMP3FrameIn = drmp3_decode_next_frame_ex(pMP3, NULL, NULL, NULL);
+            pcmFramesInCurrentMP3FrameIn = drmp3_scan_next_frame(pMP3);
             if (pcmFramesInCurrentMP3FrameIn == 0) {
                 return DRMP3_FALSE; /* This should never happen. */
             }
@@ -4758,7 +5408,7 @@ DRMP3_API drmp3_bool32 drmp3_calculate_seek_points(drmp3* pMP3, drmp3_uint32* pS
                     Go to the next MP3 frame. This shouldn't ever fail, but just in case it does we just set the seek point and break. If it happens, it
                     should only ever do it for the last seek point.
                     */
-                    pcmFramesInCurrentMP3FrameIn = drmp3_decode_next_frame_ex(pMP3, NULL, NULL, NULL);
+                    pcmFramesInCurrentMP3FrameIn = drmp3_scan_next_frame(pMP3);
                     if (pcmFramesInCurrentMP3FrameIn == 0) {
                         pSeekPoints[iSeekPoint].seekPosInBytes     = mp3FrameInfo[0].bytePos;
                         pSeekPoints[iSeekPoint].pcmFrameIndex      = nextTargetPCMFrame;
@@ -4772,11 +5422,11 @@ DRMP3_API drmp3_bool32 drmp3_calculate_seek_points(drmp3* pMP3, drmp3_uint32* pS
             }
         }
 
-        /* Finally, we need to seek back to where we were. */
+        /* Finally, we need to seek back to where we were. This needs to be exact so the Xing/Info TOC must not be used. */
         if (!drmp3_seek_to_start_of_stream(pMP3)) {
             return DRMP3_FALSE;
         }
-        if (!drmp3_seek_to_pcm_frame(pMP3, currentPCMFrame)) {
+        if (!drmp3_seek_to_pcm_frame__internal(pMP3, currentPCMFrame, DRMP3_FALSE)) {
             return DRMP3_FALSE;
         }
     }
@@ -5008,6 +5658,653 @@ DRMP3_API drmp3_int16* drmp3_open_file_and_read_pcm_frames_s16(const char* fileP
 }
 #endif
 
+/* Multithreaded Decoding */
+#if !defined(DR_MP3_NO_THREADING)
+    #if defined(_WIN32) && !defined(NXDK)
+        #define DRMP3_THREADING_WIN32
+    #elif defined(__unix__) || defined(__unix) || defined(__APPLE__) || defined(__HAIKU__)
+        #define DRMP3_THREADING_POSIX
+    #endif
+#endif
+
+#if defined(DRMP3_THREADING_WIN32)
+    /*
+    We don't include <windows.h> because of how much it drags into the translation unit. Instead the few kernel32 functions we need
+    are declared here. The types match the real declarations exactly so <windows.h> can still be included alongside this.
+    */
+    #if defined(_WIN64)
+        typedef unsigned __int64 drmp3_win32_size_t;
+    #else
+        typedef unsigned long drmp3_win32_size_t;
+    #endif
+
+    typedef struct
+    {
+        unsigned long dwOemId;
+        unsigned long dwPageSize;
+        void* lpMinimumApplicationAddress;
+        void* lpMaximumApplicationAddress;
+        drmp3_win32_size_t dwActiveProcessorMask;
+        unsigned long dwNumberOfProcessors;
+        unsigned long dwProcessorType;
+        unsigned long dwAllocationGranularity;
+        unsigned short wProcessorLevel;
+        unsigned short wProcessorRevision;
+    } drmp3_win32_system_info;   /* Same layout as SYSTEM_INFO. */
+
+    struct _SECURITY_ATTRIBUTES;
+    struct _SYSTEM_INFO;
+
+    #ifdef __cplusplus
+    extern "C" {
+    #endif
+    __declspec(dllimport) void* __stdcall CreateThread(struct _SECURITY_ATTRIBUTES* lpThreadAttributes, drmp3_win32_size_t dwStackSize, unsigned long (__stdcall* lpStartAddress)(void*), void* lpParameter, unsigned long dwCreationFlags, unsigned long* lpThreadId);
+    __declspec(dllimport) unsigned long __stdcall WaitForSingleObject(void* hHandle, unsigned long dwMilliseconds);
+    __declspec(dllimport) int __stdcall CloseHandle(void* hObject);
+    __declspec(dllimport) void __stdcall GetSystemInfo(struct _SYSTEM_INFO* lpSystemInfo);
+    #ifdef __cplusplus
+    }
+    #endif
+#elif defined(DRMP3_THREADING_POSIX)
+    #include <pthread.h>
+    #include <unistd.h>     /* For sysconf(). */
+#endif
+
+/* Segments shorter than this are not worth the cost of the warm-up frames and spinning up a thread. */
+#define DRMP3_MT_MIN_SEGMENT_SIZE_IN_PCM_FRAMES     65536
+#define DRMP3_MT_MAX_THREAD_COUNT                   64
+
+/*
+The maximum number of MP3 frames that are decoded and discarded before a segment. This needs to be enough to fill the bit reservoir
+for even the smallest MP3 frames.
+*/
+#define DRMP3_MT_MAX_WARMUP_MP3_FRAMES              32
+
+/* The number of places a segment could start that are remembered for each thread while scanning the stream. Must be even. */
+#define DRMP3_MT_SEGMENT_CANDIDATES_PER_THREAD      32
+
+typedef struct
+{
+    const drmp3_uint8* pData;       /* The whole stream. */
+    size_t dataSize;
+    size_t warmupPos;               /* Where decoding starts. MP3 frames before startPos are decoded and discarded. */
+    size_t startPos;                /* The position of the first MP3 frame of the segment. */
+    size_t endPos;                  /* The position of the first MP3 frame of the next segment. Ignored for the last segment. */
+    drmp3_uint32 warmupFramesToCheck;   /* The number of MP3 frames right before startPos that must have been decoded successfully. */
+    drmp3_bool32 isLastSegment;
+    drmp3_uint64 firstPCMFrame;     /* The index of the first PCM frame of the MP3 frame at startPos, including the encoder delay. */
+    drmp3_uint64 endPCMFrame;       /* The index of the first PCM frame of the MP3 frame at endPos. */
+    drmp3_uint64 outputBegPCMFrame; /* PCM frames before this are not output. This is the encoder delay. */
+    drmp3_uint64 outputEndPCMFrame; /* PCM frames from this one are not output. This is where the padding starts. */
+    drmp3_uint32 channels;
+    drmp3_uint32 format;            /* DRMP3_FORMAT_S16 or DRMP3_FORMAT_F32. MP3 frames are decoded straight to this format. */
+    void* pFramesOut;               /* Where PCM frame outputBegPCMFrame is written. This is the same for every segment. */
+    drmp3_bool32 result;
+} drmp3__segment_job;
+
+static void drmp3__decode_segment(drmp3__segment_job* pJob)
+{
+    drmp3dec decoder;
+    drmp3dec_frame_info info;
+    float pcmFrames[DRMP3_MAX_SAMPLES_PER_FRAME];   /* <-- Big enough for either format. */
+    size_t bytesPerSample;
+    size_t pos;
+    drmp3_uint64 pcmFrame;
+    drmp3_uint32 successfulWarmupFrameCount = 0;
+
+    DRMP3_ASSERT(pJob != NULL);
+
+    pJob->result = DRMP3_FALSE;
+    bytesPerSample = DRMP3_FORMAT_SAMPLE_SIZE(pJob->format);
+
+    drmp3dec_init(&decoder);
+
+    /*
+    The warm-up frames are decoded in full, rather than being scanned, so that the synthesis filter state is correct. The frames
+    right before the segment need to have decoded successfully, which is only the case when the bit reservoir was full enough.
+    */
+    pos = pJob->warmupPos;
+    while (pos < pJob->startPos) {
+        int pcmFrameCount = drmp3dec_decode_frame_ex(&decoder, pJob->pData + pos, (int)(pJob->dataSize - pos), pcmFrames, &info, (int)pJob->format);
+        if (info.frame_bytes == 0) {
+            return;
+        }
+
+        successfulWarmupFrameCount = (pcmFrameCount > 0) ? successfulWarmupFrameCount + 1 : 0;
+        pos += (size_t)info.frame_bytes;
+    }
+
+    if (pos != pJob->startPos || successfulWarmupFrameCount < pJob->warmupFramesToCheck) {
+        return;
+    }
+
+    /* This follows the same steps as drmp3_decode_next_frame_ex__memory() so that we land on the same MP3 frames. */
+    pcmFrame = pJob->firstPCMFrame;
+    while (pJob->isLastSegment || pos < pJob->endPos) {
+        drmp3_uint64 frameBeg;
+        drmp3_uint64 frameEnd;
+        int pcmFrameCount = drmp3dec_decode_frame_ex(&decoder, pJob->pData + pos, (int)(pJob->dataSize - pos), pcmFrames, &info, (int)pJob->format);
+        if (info.frame_bytes == 0) {
+            break;
+        }
+
+        pos += (size_t)info.frame_bytes;
+
+        if (pcmFrameCount == 0) {
+            continue;
+        }
+
+        if ((drmp3_uint32)info.channels != pJob->channels) {
+            return;
+        }
+
+        /* Only the part of the MP3 frame that falls between the delay and the padding is output. */
+        frameBeg = DRMP3_MAX(pcmFrame, pJob->outputBegPCMFrame);
+        frameEnd = DRMP3_MIN(pcmFrame + pcmFrameCount, pJob->outputEndPCMFrame);
+
+        if (frameBeg < frameEnd) {
+            const void* pFramesIn = DRMP3_OFFSET_PTR(pcmFrames, bytesPerSample * (size_t)(frameBeg - pcmFrame) * pJob->channels);
+            size_t sampleCount = (size_t)(frameEnd - frameBeg) * pJob->channels;
+            size_t sampleOffset = (size_t)(frameBeg - pJob->outputBegPCMFrame) * pJob->channels;
+
+            DRMP3_COPY_MEMORY(DRMP3_OFFSET_PTR(pJob->pFramesOut, bytesPerSample * sampleOffset), pFramesIn, bytesPerSample * sampleCount);
+        }
+
+        pcmFrame += pcmFrameCount;
+    }
+
+    /* If the segment doesn't end exactly where the scan said it would, the output can't be trusted. */
+    if (pcmFrame != pJob->endPCMFrame) {
+        return;
+    }
+    if (!pJob->isLastSegment && pos != pJob->endPos) {
+        return;
+    }
+
+    pJob->result = DRMP3_TRUE;
+}
+
+#if defined(DRMP3_THREADING_WIN32)
+typedef void* drmp3_thread;
+
+static unsigned long __stdcall drmp3__segment_job_thread(void* pUserData)
+{
+    drmp3__decode_segment((drmp3__segment_job*)pUserData);
+    return 0;
+}
+
+static drmp3_bool32 drmp3__thread_create(drmp3_thread* pThread, drmp3__segment_job* pJob)
+{
+    *pThread = CreateThread(NULL, 0, drmp3__segment_job_thread, pJob, 0, NULL);
+    return *pThread != NULL;
+}
+
+static void drmp3__thread_wait(drmp3_thread* pThread)
+{
+    WaitForSingleObject(*pThread, 0xFFFFFFFF);  /* INFINITE */
+    CloseHandle(*pThread);
+}
+
+static drmp3_uint32 drmp3__get_logical_cpu_count(void)
+{
+    drmp3_win32_system_info info;
+    GetSystemInfo((struct _SYSTEM_INFO*)&info);
+    return (drmp3_uint32)info.dwNumberOfProcessors;
+}
+#elif defined(DRMP3_THREADING_POSIX)
+typedef pthread_t drmp3_thread;
+
+static void* drmp3__segment_job_thread(void* pUserData)
+{
+    drmp3__decode_segment((drmp3__segment_job*)pUserData);
+    return NULL;
+}
+
+static drmp3_bool32 drmp3__thread_create(drmp3_thread* pThread, drmp3__segment_job* pJob)
+{
+    return pthread_create(pThread, NULL, drmp3__segment_job_thread, pJob) == 0;
+}
+
+static void drmp3__thread_wait(drmp3_thread* pThread)
+{
+    pthread_join(*pThread, NULL);
+}
+
+static drmp3_uint32 drmp3__get_logical_cpu_count(void)
+{
+#if defined(_SC_NPROCESSORS_ONLN)
+    long count = sysconf(_SC_NPROCESSORS_ONLN);
+    if (count > 0) {
+        return (drmp3_uint32)count;
+    }
+#endif
+    return 1;
+}
+#else
+static drmp3_uint32 drmp3__get_logical_cpu_count(void)
+{
+    return 1;
+}
+#endif
+
+/*
+Where a segment could start. The stream is only scanned once so we don't know where the segment boundaries will be until we've reached
+the end. Instead we record candidates at regular intervals while counting the PCM frames and then pick from them.
+*/
+typedef struct
+{
+    size_t warmupPos;
+    size_t startPos;
+    drmp3_uint32 warmupFramesToCheck;
+    drmp3_uint64 firstPCMFrame;
+} drmp3__segment_start;
+
+typedef struct
+{
+    size_t streamStartPos;          /* Where the first segment starts. */
+    drmp3_uint64 totalPCMFrameCount;
+    drmp3_uint64 candidateSpacing;  /* In PCM frames. Doubled each time the candidate list fills up. */
+    drmp3_uint32 candidateCount;
+    drmp3_uint32 candidateCap;      /* A multiple of 2. */
+    drmp3__segment_start* pCandidates;
+} drmp3__segment_scan;
+
+/*
+Counts the PCM frames in the stream while recording where segments could start. Returns false if the stream can't be split, in which
+case it needs to be decoded on a single thread. The list of candidates must be allocated by the caller. The candidates are never more
+than two candidateCap-ths of the stream apart so with enough of them for each thread the segments end up close to their ideal size.
+*/
+static drmp3_bool32 drmp3__scan_segments(drmp3* pMP3, drmp3__segment_scan* pScan)
+{
+    struct
+    {
+        size_t pos;
+        size_t bytes;
+    } recentFrames[DRMP3_MT_MAX_WARMUP_MP3_FRAMES];
+    drmp3dec_frame_info info;
+    const drmp3_uint8* pFrameData;
+    drmp3_uint64 mp3FrameIndex = 0;
+    drmp3_uint64 runningPCMFrameCount = 0;
+
+    if (!drmp3_seek_to_start_of_stream(pMP3)) {
+        return DRMP3_FALSE;
+    }
+
+    pScan->streamStartPos = pMP3->memory.currentReadPos;
+
+    pScan->candidateSpacing = DRMP3_MT_MIN_SEGMENT_SIZE_IN_PCM_FRAMES / 16;
+    pScan->candidateCount   = 0;
+
+    for (;;) {
+        drmp3_uint32 pcmFrameCount = drmp3_decode_next_frame_ex__memory(pMP3, NULL, &info, &pFrameData, DRMP3_TRUE);
+        if (pcmFrameCount == 0) {
+            break;
+        }
+
+        if (pScan->candidateCount == pScan->candidateCap) {
+            /* Full. Keep every second candidate which are the ones sitting on a multiple of the doubled spacing. */
+            drmp3_uint32 iCandidate;
+            for (iCandidate = 0; iCandidate < pScan->candidateCap/2; iCandidate += 1) {
+                pScan->pCandidates[iCandidate] = pScan->pCandidates[iCandidate*2 + 1];
+            }
+
+            pScan->candidateCount    = pScan->candidateCap/2;
+            pScan->candidateSpacing *= 2;
+        }
+
+        /* Candidate N is the first MP3 frame starting at or after PCM frame N * candidateSpacing, with N starting at 1. */
+        if (runningPCMFrameCount >= pScan->candidateSpacing * (pScan->candidateCount + 1)) {
+            drmp3__segment_start* pCandidate = &pScan->pCandidates[pScan->candidateCount];
+            drmp3_uint32 warmupFrameCount;
+            size_t reservoirBytes = 0;
+
+            /*
+            The two MP3 frames right before the segment must decode successfully. Before those we need enough frames to fill the bit
+            reservoir. The main data of a frame is at least the size of the frame minus the header, CRC and the largest side info.
+            */
+            for (warmupFrameCount = 2; warmupFrameCount < DRMP3_MT_MAX_WARMUP_MP3_FRAMES && reservoirBytes < DRMP3_MAX_BITRESERVOIR_BYTES; warmupFrameCount += 1) {
+                size_t frameBytes;
+
+                if (warmupFrameCount >= mp3FrameIndex) {
+                    break;
+                }
+
+                frameBytes = recentFrames[(mp3FrameIndex - warmupFrameCount - 1) % DRMP3_MT_MAX_WARMUP_MP3_FRAMES].bytes;
+                if (frameBytes > DRMP3_HDR_SIZE + 2 + 32) {
+                    reservoirBytes += frameBytes - (DRMP3_HDR_SIZE + 2 + 32);
+                }
+            }
+
+            if (warmupFrameCount >= mp3FrameIndex) {
+                /* Everything before the segment is needed so just start from the beginning. This is exactly what a single threaded decode does. */
+                pCandidate->warmupPos           = pScan->streamStartPos;
+                pCandidate->warmupFramesToCheck = 0;
+            } else {
+                pCandidate->warmupPos           = recentFrames[(mp3FrameIndex - warmupFrameCount) % DRMP3_MT_MAX_WARMUP_MP3_FRAMES].pos;
+                pCandidate->warmupFramesToCheck = 2;
+            }
+
+            pCandidate->startPos      = (size_t)(pFrameData - pMP3->memory.pData);
+            pCandidate->firstPCMFrame = runningPCMFrameCount;
+
+            pScan->candidateCount += 1;
+        }
+
+        /* Changes to the channel count or sample rate are handled by the single threaded path. */
+        if ((drmp3_uint32)info.channels != pMP3->channels || (drmp3_uint32)info.sample_rate != pMP3->sampleRate) {
+            return DRMP3_FALSE;
+        }
+
+        recentFrames[mp3FrameIndex % DRMP3_MT_MAX_WARMUP_MP3_FRAMES].pos   = (size_t)(pFrameData - pMP3->memory.pData);
+        recentFrames[mp3FrameIndex % DRMP3_MT_MAX_WARMUP_MP3_FRAMES].bytes = (size_t)info.frame_bytes;
+
+        mp3FrameIndex        += 1;
+        runningPCMFrameCount += pcmFrameCount;
+    }
+
+    pScan->totalPCMFrameCount = runningPCMFrameCount;
+    return DRMP3_TRUE;
+}
+
+/*
+Fills out the position and PCM frame range of each segment from the candidates found by drmp3__scan_segments(). Each segment starts at
+the candidate closest to its ideal starting point. Returns false if there aren't enough candidates.
+*/
+static drmp3_bool32 drmp3__plan_segments(const drmp3__segment_scan* pScan, size_t dataSize, drmp3__segment_job* pJobs, drmp3_uint32 segmentCount)
+{
+    drmp3_uint64 outputPCMFrameCount;
+    drmp3_uint32 iSegment;
+    drmp3_uint32 iCandidate = 0;    /* The first candidate that's still available. Segments can't share a starting point. */
+
+    DRMP3_ASSERT(segmentCount > 1);
+
+    outputPCMFrameCount = pJobs[0].outputEndPCMFrame - pJobs[0].outputBegPCMFrame;
+
+    pJobs[0].warmupPos           = pScan->streamStartPos;
+    pJobs[0].startPos            = pScan->streamStartPos;
+    pJobs[0].warmupFramesToCheck = 0;
+    pJobs[0].firstPCMFrame       = 0;
+
+    for (iSegment = 1; iSegment < segmentCount; iSegment += 1) {
+        drmp3__segment_job* pJob = &pJobs[iSegment];
+        const drmp3__segment_start* pCandidate;
+        drmp3_uint64 idealFirstPCMFrame = pJobs[0].outputBegPCMFrame + (outputPCMFrameCount * iSegment) / segmentCount;
+        drmp3_uint32 iCandidateAfter = iCandidate;
+
+        while (iCandidateAfter < pScan->candidateCount && pScan->pCandidates[iCandidateAfter].firstPCMFrame < idealFirstPCMFrame) {
+            iCandidateAfter += 1;
+        }
+
+        /* Use whichever of the candidates either side of the ideal starting point is closer. */
+        if (iCandidateAfter > iCandidate && (iCandidateAfter == pScan->candidateCount || idealFirstPCMFrame - pScan->pCandidates[iCandidateAfter-1].firstPCMFrame < pScan->pCandidates[iCandidateAfter].firstPCMFrame - idealFirstPCMFrame)) {
+            iCandidate = iCandidateAfter - 1;
+        } else {
+            iCandidate = iCandidateAfter;
+        }
+
+        if (iCandidate == pScan->candidateCount) {
+            return DRMP3_FALSE;
+        }
+
+        pCandidate = &pScan->pCandidates[iCandidate];
+
+        pJob->warmupPos           = pCandidate->warmupPos;
+        pJob->startPos            = pCandidate->startPos;
+        pJob->warmupFramesToCheck = pCandidate->warmupFramesToCheck;
+        pJob->firstPCMFrame       = pCandidate->firstPCMFrame;
+
+        pJobs[iSegment-1].endPos      = pJob->startPos;
+        pJobs[iSegment-1].endPCMFrame = pJob->firstPCMFrame;
+
+        iCandidate += 1;
+    }
+
+    pJobs[segmentCount-1].endPos      = dataSize;
+    pJobs[segmentCount-1].endPCMFrame = pScan->totalPCMFrameCount;
+
+    return DRMP3_TRUE;
+}
+
+static void* drmp3__full_read_and_close_mt(drmp3* pMP3, drmp3_uint32 threadCount, drmp3_uint32 format, drmp3_config* pConfig, drmp3_uint64* pTotalFrameCount)
+{
+    drmp3__segment_scan scan;
+    drmp3__segment_job jobs[DRMP3_MT_MAX_THREAD_COUNT];
+#if defined(DRMP3_THREADING_WIN32) || defined(DRMP3_THREADING_POSIX)
+    drmp3_thread threads[DRMP3_MT_MAX_THREAD_COUNT];
+    drmp3_bool32 isThreadRunning[DRMP3_MT_MAX_THREAD_COUNT];
+#endif
+    drmp3_uint32 segmentCount;
+    drmp3_uint32 iSegment;
+    drmp3_uint64 totalPCMFrameCount;
+    drmp3_uint64 outputBegPCMFrame;
+    drmp3_uint64 outputEndPCMFrame;
+    drmp3_uint64 sampleDataSizeInBytes;
+    size_t bytesPerSample;
+    void* pSampleData = NULL;
+    drmp3_bool32 wasSuccessful;
+
+    DRMP3_ASSERT(pMP3 != NULL);
+    DRMP3_ASSERT(pMP3->memory.pData != NULL);
+
+    bytesPerSample = DRMP3_FORMAT_SAMPLE_SIZE(format);
+    scan.pCandidates = NULL;
+
+    if (threadCount == 0) {
+        threadCount = drmp3__get_logical_cpu_count();
+    }
+    if (threadCount > DRMP3_MT_MAX_THREAD_COUNT) {
+        threadCount = DRMP3_MT_MAX_THREAD_COUNT;
+    }
+
+    if (threadCount <= 1) {
+        goto single_threaded;
+    }
+
+    scan.candidateCap = threadCount * DRMP3_MT_SEGMENT_CANDIDATES_PER_THREAD;
+    scan.pCandidates  = (drmp3__segment_start*)drmp3__malloc_from_callbacks(sizeof(*scan.pCandidates) * scan.candidateCap, &pMP3->allocationCallbacks);
+    if (scan.pCandidates == NULL) {
+        goto single_threaded;
+    }
+
+    /* We need the exact length up front. The Xing/Info frame count is not trusted for this. */
+    if (!drmp3__scan_segments(pMP3, &scan)) {
+        goto single_threaded;
+    }
+
+    totalPCMFrameCount = scan.totalPCMFrameCount;
+
+    /* This is the same range drmp3_read_pcm_frames_raw() ends up outputting. */
+    outputBegPCMFrame = pMP3->delayInPCMFrames;
+    outputEndPCMFrame = totalPCMFrameCount;
+    if (pMP3->totalPCMFrameCount != DRMP3_UINT64_MAX && pMP3->totalPCMFrameCount > pMP3->paddingInPCMFrames) {
+        outputEndPCMFrame = DRMP3_MIN(outputEndPCMFrame, pMP3->totalPCMFrameCount - pMP3->paddingInPCMFrames);
+    }
+
+    segmentCount = 1;
+    if (outputEndPCMFrame > outputBegPCMFrame) {
+        drmp3_uint64 maxSegmentCount = (outputEndPCMFrame - outputBegPCMFrame) / DRMP3_MT_MIN_SEGMENT_SIZE_IN_PCM_FRAMES;
+        segmentCount = (maxSegmentCount < threadCount) ? (drmp3_uint32)maxSegmentCount : threadCount;
+    }
+
+    if (segmentCount <= 1) {
+        goto single_threaded;
+    }
+
+    sampleDataSizeInBytes = (outputEndPCMFrame - outputBegPCMFrame) * pMP3->channels * bytesPerSample;
+    if (sampleDataSizeInBytes > DRMP3_SIZE_MAX) {
+        goto single_threaded;
+    }
+
+    pSampleData = drmp3__malloc_from_callbacks((size_t)sampleDataSizeInBytes, &pMP3->allocationCallbacks);
+    if (pSampleData == NULL) {
+        goto single_threaded;
+    }
+
+    for (iSegment = 0; iSegment < segmentCount; iSegment += 1) {
+        drmp3__segment_job* pJob = &jobs[iSegment];
+
+        pJob->pData             = pMP3->memory.pData;
+        pJob->dataSize          = pMP3->memory.dataSize;
+        pJob->isLastSegment     = iSegment == segmentCount-1;
+        pJob->outputBegPCMFrame = outputBegPCMFrame;
+        pJob->outputEndPCMFrame = outputEndPCMFrame;
+        pJob->channels          = pMP3->channels;
+        pJob->format            = format;
+        pJob->pFramesOut        = pSampleData;
+        pJob->result            = DRMP3_FALSE;
+    }
+
+    wasSuccessful = drmp3__plan_segments(&scan, pMP3->memory.dataSize, jobs, segmentCount);
+
+    drmp3__free_from_callbacks(scan.pCandidates, &pMP3->allocationCallbacks);
+    scan.pCandidates = NULL;
+
+    if (!wasSuccessful) {
+        goto fallback;
+    }
+
+    /* The first segment is decoded on the calling thread. If a thread cannot be created, the segment is decoded on this thread instead. */
+#if defined(DRMP3_THREADING_WIN32) || defined(DRMP3_THREADING_POSIX)
+    for (iSegment = 1; iSegment < segmentCount; iSegment += 1) {
+        isThreadRunning[iSegment] = drmp3__thread_create(&threads[iSegment], &jobs[iSegment]);
+    }
+
+    drmp3__decode_segment(&jobs[0]);
+
+    for (iSegment = 1; iSegment < segmentCount; iSegment += 1) {
+        if (isThreadRunning[iSegment]) {
+            drmp3__thread_wait(&threads[iSegment]);
+        } else {
+            drmp3__decode_segment(&jobs[iSegment]);
+        }
+    }
+#else
+    for (iSegment = 0; iSegment < segmentCount; iSegment += 1) {
+        drmp3__decode_segment(&jobs[iSegment]);
+    }
+#endif
+
+    wasSuccessful = DRMP3_TRUE;
+    for (iSegment = 0; iSegment < segmentCount; iSegment += 1) {
+        if (!jobs[iSegment].result) {
+            wasSuccessful = DRMP3_FALSE;
+            break;
+        }
+    }
+
+    if (!wasSuccessful) {
+        goto fallback;
+    }
+
+    if (pConfig != NULL) {
+        pConfig->channels   = pMP3->channels;
+        pConfig->sampleRate = pMP3->sampleRate;
+    }
+
+    if (pTotalFrameCount) {
+        *pTotalFrameCount = outputEndPCMFrame - outputBegPCMFrame;
+    }
+
+    drmp3_uninit(pMP3);
+    return pSampleData;
+
+fallback:
+    /* Something is not right with the stream. Start again from the beginning on a single thread which will handle it gracefully. */
+    drmp3__free_from_callbacks(pSampleData, &pMP3->allocationCallbacks);
+
+single_threaded:
+    drmp3__free_from_callbacks(scan.pCandidates, &pMP3->allocationCallbacks);
+
+    if (!drmp3_seek_to_start_of_stream(pMP3)) {
+        drmp3_uninit(pMP3);
+        return NULL;
+    }
+
+    if (format == DRMP3_FORMAT_S16) {
+        return drmp3__full_read_and_close_s16(pMP3, pConfig, pTotalFrameCount);
+    } else {
+        return drmp3__full_read_and_close_f32(pMP3, pConfig, pTotalFrameCount);
+    }
+}
+
+static void* drmp3__open_memory_and_read_pcm_frames_mt(const void* pData, size_t dataSize, drmp3_uint32 threadCount, drmp3_uint32 format, drmp3_config* pConfig, drmp3_uint64* pTotalFrameCount, const drmp3_allocation_callbacks* pAllocationCallbacks)
+{
+    drmp3 mp3;
+    if (!drmp3_init_memory(&mp3, pData, dataSize, pAllocationCallbacks)) {
+        return NULL;
+    }
+
+    return drmp3__full_read_and_close_mt(&mp3, threadCount, format, pConfig, pTotalFrameCount);
+}
+
+DRMP3_API float* drmp3_open_memory_and_read_pcm_frames_f32_mt(const void* pData, size_t dataSize, drmp3_uint32 threadCount, drmp3_config* pConfig, drmp3_uint64* pTotalFrameCount, const drmp3_allocation_callbacks* pAllocationCallbacks)
+{
+    return (float*)drmp3__open_memory_and_read_pcm_frames_mt(pData, dataSize, threadCount, DRMP3_FORMAT_F32, pConfig, pTotalFrameCount, pAllocationCallbacks);
+}
+
+DRMP3_API drmp3_int16* drmp3_open_memory_and_read_pcm_frames_s16_mt(const void* pData, size_t dataSize, drmp3_uint32 threadCount, drmp3_config* pConfig, drmp3_uint64* pTotalFrameCount, const drmp3_allocation_callbacks* pAllocationCallbacks)
+{
+    return (drmp3_int16*)drmp3__open_memory_and_read_pcm_frames_mt(pData, dataSize, threadCount, DRMP3_FORMAT_S16, pConfig, pTotalFrameCount, pAllocationCallbacks);
+}
+
+#ifndef DR_MP3_NO_STDIO
+static void* drmp3__open_file_and_read_pcm_frames_mt(const char* filePath, drmp3_uint32 threadCount, drmp3_uint32 format, drmp3_config* pConfig, drmp3_uint64* pTotalFrameCount, const drmp3_allocation_callbacks* pAllocationCallbacks)
+{
+    drmp3_allocation_callbacks allocationCallbacks;
+    FILE* pFile;
+    drmp3_int64 fileSize = 0;
+    void* pFileData = NULL;
+    void* pFrames;
+
+    allocationCallbacks = drmp3_copy_allocation_callbacks_or_defaults(pAllocationCallbacks);
+
+    /* Each thread needs random access to the whole stream so the file is loaded into memory first. */
+    if (drmp3_fopen(&pFile, filePath, "rb") != DRMP3_SUCCESS) {
+        return NULL;
+    }
+
+    if (fseek(pFile, 0, SEEK_END) == 0) {
+        drmp3__on_tell_stdio(pFile, &fileSize);
+    }
+
+    if (fileSize > 0 && (drmp3_uint64)fileSize <= DRMP3_SIZE_MAX && fseek(pFile, 0, SEEK_SET) == 0) {
+        pFileData = drmp3__malloc_from_callbacks((size_t)fileSize, &allocationCallbacks);
+        if (pFileData != NULL && fread(pFileData, 1, (size_t)fileSize, pFile) != (size_t)fileSize) {
+            drmp3__free_from_callbacks(pFileData, &allocationCallbacks);
+            pFileData = NULL;
+        }
+    }
+
+    fclose(pFile);
+
+    /* If the file couldn't be loaded it's decoded on a single thread straight from the file. */
+    if (pFileData == NULL) {
+        if (format == DRMP3_FORMAT_S16) {
+            return drmp3_open_file_and_read_pcm_frames_s16(filePath, pConfig, pTotalFrameCount, pAllocationCallbacks);
+        } else {
+            return drmp3_open_file_and_read_pcm_frames_f32(filePath, pConfig, pTotalFrameCount, pAllocationCallbacks);
+        }
+    }
+
+    pFrames = drmp3__open_memory_and_read_pcm_frames_mt(pFileData, (size_t)fileSize, threadCount, format, pConfig, pTotalFrameCount, pAllocationCallbacks);
+
+    drmp3__free_from_callbacks(pFileData, &allocationCallbacks);
+    return pFrames;
+}
+
+DRMP3_API float* drmp3_open_file_and_read_pcm_frames_f32_mt(const char* filePath, drmp3_uint32 threadCount, drmp3_config* pConfig, drmp3_uint64* pTotalFrameCount, const drmp3_allocation_callbacks* pAllocationCallbacks)
+{
+    return (float*)drmp3__open_file_and_read_pcm_frames_mt(filePath, threadCount, DRMP3_FORMAT_F32, pConfig, pTotalFrameCount, pAllocationCallbacks);
+}
+
+DRMP3_API drmp3_int16* drmp3_open_file_and_read_pcm_frames_s16_mt(const char* filePath, drmp3_uint32 threadCount, drmp3_config* pConfig, drmp3_uint64* pTotalFrameCount, const drmp3_allocation_callbacks* pAllocationCallbacks)
+{
+    return (drmp3_int16*)drmp3__open_file_and_read_pcm_frames_mt(filePath, threadCount, DRMP3_FORMAT_S16, pConfig, pTotalFrameCount, pAllocationCallbacks);
+}
+#endif
+/* End Multithreaded Decoding */
+
+
 DRMP3_API void* drmp3_malloc(size_t sz, const drmp3_allocation_callbacks* pAllocationCallbacks)
 {
     if (pAllocationCallbacks != NULL) {
@@ -5052,6 +6349,11 @@ v0.7.4 - TBD
   - Add some validation checks for "Xing" and "Info" tag parsing.
   - Reduce size of some stack allocations.
   - Improvements to SIMD detection.
+  - Add drmp3_seek_to_pcm_frame_approximate() which uses the Xing/Info TOC for fast, approximate seeking when no seek table has been bound.
+  - Count frames and calculate seek points by parsing only MP3 frame headers and side info rather than running the decoder.
+  - Add AVX2 versions of the synthesis filter, DCT-II, IMDCT and anti-aliasing butterflies. These are selected at runtime and can be disabled with DR_MP3_NO_AVX2.
+  - Add multithreaded whole-stream decoding APIs: drmp3_open_memory_and_read_pcm_frames_f32/s16_mt() and drmp3_open_file_and_read_pcm_frames_f32/s16_mt().
+  - Add drmp3dec_decode_frame_with_scratch() and the DR_MP3_NO_EMBEDDED_SCRATCH option for sharing decoder scratch memory between decoders.
 
 v0.7.3 - 2026-01-17
   - Fix an error in drmp3_open_and_read_pcm_frames_s16() and family when memory allocation fails.
@@ -94,9 +94,15 @@ Build Options
 #define DR_WAV_NO_STDIO
   Disables APIs that initialize a decoder from a file such as `drwav_init_file()`, `drwav_init_file_write()`, etc.
 
+#define DR_WAV_NO_SIMD
+  Disables the SSE2, AVX2 and NEON optimized sample format conversion routines.
+
 #define DR_WAV_NO_WCHAR
   Disables all functions ending with `_w`. Use this if your compiler does not provide wchar.h. Not required if DR_WAV_NO_STDIO is also defined.
 
+#define DR_WAV_NO_MMAP
+  Disables `drwav_init_file_mmap()`, `drwav_init_file_mmap_ex()` and their `_w` variants. Use this if you don't want dr_wav to include the platform headers required for memory mapping. Not required if DR_WAV_NO_STDIO is also defined.
+
 
 Supported Encapsulations
 ========================
@@ -933,6 +939,10 @@ typedef struct
     drwav__memory_stream memoryStream;
     drwav__memory_stream_write memoryStreamWrite;
 
+    /* The mapped view of the file when opened with drwav_init_file_mmap(). This is unmapped in drwav_uninit(). */
+    void* pMappedFileData;
+    size_t mappedFileDataSize;
+
 
     /* Microsoft ADPCM specific data. */
     struct
@@ -1087,6 +1097,18 @@ DRWAV_API drwav_uint64 drwav_read_pcm_frames(drwav* pWav, drwav_uint64 framesToR
 DRWAV_API drwav_uint64 drwav_read_pcm_frames_le(drwav* pWav, drwav_uint64 framesToRead, void* pBufferOut);
 DRWAV_API drwav_uint64 drwav_read_pcm_frames_be(drwav* pWav, drwav_uint64 framesToRead, void* pBufferOut);
 
+/*
+Retrieves a pointer to the sample data at the current read position without copying it, and moves the read position forward.
+
+This is only supported for decoders initialized with drwav_init_memory() or drwav_init_file_mmap() where the sample data is
+uncompressed and already laid out the same as the output of drwav_read_pcm_frames(). Frames are tightly packed with a stride
+of drwav_get_bytes_per_pcm_frame() bytes. The pointer remains valid for as long as the underlying buffer is valid.
+
+Returns the number of PCM frames that can be accessed through *ppFramesOut. If mapping is not supported, 0 is returned and
+*ppFramesOut is set to NULL, in which case you should use drwav_read_pcm_frames() instead.
+*/
+DRWAV_API drwav_uint64 drwav_map_pcm_frames(drwav* pWav, drwav_uint64 framesToMap, const void** ppFramesOut);
+
 /*
 Seeks to the given PCM frame.
 
@@ -1251,6 +1273,23 @@ DRWAV_API drwav_bool32 drwav_init_file_ex_w(drwav* pWav, const wchar_t* filename
 DRWAV_API drwav_bool32 drwav_init_file_with_metadata(drwav* pWav, const char* filename, drwav_uint32 flags, const drwav_allocation_callbacks* pAllocationCallbacks);
 DRWAV_API drwav_bool32 drwav_init_file_with_metadata_w(drwav* pWav, const wchar_t* filename, drwav_uint32 flags, const drwav_allocation_callbacks* pAllocationCallbacks);
 
+#ifndef DR_WAV_NO_MMAP
+/*
+Helper for initializing a wave file for reading by memory mapping it.
+
+This works the same as drwav_init_memory() on the contents of the file, except the file is mapped into memory rather than
+read through stdio. Combined with drwav_map_pcm_frames() this allows uncompressed sample data to be accessed without any
+copying. The conversion routines such as drwav_read_pcm_frames_f32() will also convert straight out of the mapping.
+
+The mapping is released when drwav_uninit() is called. This will fail on platforms where memory mapping is not supported, in
+which case you should fall back to drwav_init_file().
+*/
+DRWAV_API drwav_bool32 drwav_init_file_mmap(drwav* pWav, const char* filename, const drwav_allocation_callbacks* pAllocationCallbacks);
+DRWAV_API drwav_bool32 drwav_init_file_mmap_ex(drwav* pWav, const char* filename, drwav_chunk_proc onChunk, void* pChunkUserData, drwav_uint32 flags, const drwav_allocation_callbacks* pAllocationCallbacks);
+DRWAV_API drwav_bool32 drwav_init_file_mmap_w(drwav* pWav, const wchar_t* filename, const drwav_allocation_callbacks* pAllocationCallbacks);
+DRWAV_API drwav_bool32 drwav_init_file_mmap_ex_w(drwav* pWav, const wchar_t* filename, drwav_chunk_proc onChunk, void* pChunkUserData, drwav_uint32 flags, const drwav_allocation_callbacks* pAllocationCallbacks);
+#endif
+
 
 /*
 Helper for initializing a wave file for writing using stdio.
@@ -1375,6 +1414,53 @@ DRWAV_API drwav_bool32 drwav_fourcc_equal(const drwav_uint8* a, const char* b);
 #endif
 #endif
 
+#if !defined(DR_WAV_NO_STDIO) && !defined(DR_WAV_NO_MMAP)
+    #if defined(_WIN32)
+        /*
+        We don't include <windows.h> because of how much it drags into the translation unit. Instead the few kernel32 functions we need
+        are declared here. The types match the real declarations exactly so <windows.h> can still be included alongside this.
+        */
+        #if defined(_WIN64)
+            typedef unsigned __int64 drwav_win32_size_t;
+        #else
+            typedef unsigned long drwav_win32_size_t;
+        #endif
+
+        #define DRWAV_WIN32_GENERIC_READ            0x80000000
+        #define DRWAV_WIN32_FILE_SHARE_READ         0x00000001
+        #define DRWAV_WIN32_OPEN_EXISTING           3
+        #define DRWAV_WIN32_FILE_ATTRIBUTE_NORMAL   0x00000080
+        #define DRWAV_WIN32_PAGE_READONLY           0x00000002
+        #define DRWAV_WIN32_FILE_MAP_READ           0x00000004
+        #define DRWAV_WIN32_INVALID_HANDLE_VALUE    ((void*)(drwav_uintptr)-1)
+
+        struct _SECURITY_ATTRIBUTES;
+        union _LARGE_INTEGER;
+
+        #ifdef __cplusplus
+        extern "C" {
+        #endif
+        __declspec(dllimport) void* __stdcall CreateFileA(const char* lpFileName, unsigned long dwDesiredAccess, unsigned long dwShareMode, struct _SECURITY_ATTRIBUTES* lpSecurityAttributes, unsigned long dwCreationDisposition, unsigned long dwFlagsAndAttributes, void* hTemplateFile);
+        __declspec(dllimport) void* __stdcall CreateFileW(const wchar_t* lpFileName, unsigned long dwDesiredAccess, unsigned long dwShareMode, struct _SECURITY_ATTRIBUTES* lpSecurityAttributes, unsigned long dwCreationDisposition, unsigned long dwFlagsAndAttributes, void* hTemplateFile);
+        __declspec(dllimport) int __stdcall GetFileSizeEx(void* hFile, union _LARGE_INTEGER* lpFileSize);
+        __declspec(dllimport) void* __stdcall CreateFileMappingA(void* hFile, struct _SECURITY_ATTRIBUTES* lpFileMappingAttributes, unsigned long flProtect, unsigned long dwMaximumSizeHigh, unsigned long dwMaximumSizeLow, const char* lpName);
+        __declspec(dllimport) void* __stdcall MapViewOfFile(void* hFileMappingObject, unsigned long dwDesiredAccess, unsigned long dwFileOffsetHigh, unsigned long dwFileOffsetLow, drwav_win32_size_t dwNumberOfBytesToMap);
+        __declspec(dllimport) int __stdcall UnmapViewOfFile(const void* lpBaseAddress);
+        __declspec(dllimport) int __stdcall CloseHandle(void* hObject);
+        #ifdef __cplusplus
+        }
+        #endif
+
+        #define DRWAV_HAS_MMAP
+    #elif defined(__unix__) || defined(__APPLE__)
+        #include <sys/mman.h>
+        #include <sys/stat.h>
+        #include <fcntl.h>
+        #include <unistd.h>
+        #define DRWAV_HAS_MMAP
+    #endif
+#endif
+
 /* Standard library stuff. */
 #ifndef DRWAV_ASSERT
 #include <assert.h>
@@ -1489,6 +1575,52 @@ DRWAV_API drwav_bool32 drwav_fourcc_equal(const drwav_uint8* a, const char* b);
     #endif
 #endif
 
+/*
+Intrinsics Support
+
+These are only used by the sample format conversion routines. Like dr_flac, support is determined at compile time and then
+confirmed at run time before any of the SIMD code paths are used.
+*/
+#if !defined(DR_WAV_NO_SIMD) && !defined(DR_WAV_NO_CONVERSION_API)
+    #if defined(DRWAV_X64) || defined(DRWAV_X86)
+        #if defined(_MSC_VER) && !defined(__clang__)
+            /* MSVC. */
+            #if _MSC_VER >= 1400 && !defined(DRWAV_NO_SSE2)    /* 2005 */
+                #define DRWAV_SUPPORT_SSE2
+            #endif
+            #if _MSC_VER >= 1700 && !defined(DRWAV_NO_AVX2)    /* 2012 */
+                #define DRWAV_SUPPORT_AVX2
+            #endif
+        #elif defined(__clang__) || (defined(__GNUC__) && (__GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 3)))
+            /* Assume GNUC-style. */
+            #if defined(__SSE2__) && !defined(DRWAV_NO_SSE2)
+                #define DRWAV_SUPPORT_SSE2
+            #endif
+            #if defined(__AVX2__) && !defined(DRWAV_NO_AVX2)
+                #define DRWAV_SUPPORT_AVX2
+            #endif
+        #endif
+
+        /* If at this point we still haven't determined compiler support for the intrinsics just fall back to __has_include. */
+        #if !defined(__GNUC__) && !defined(__clang__) && defined(__has_include)
+            #if !defined(DRWAV_SUPPORT_SSE2) && !defined(DRWAV_NO_SSE2) && __has_include(<emmintrin.h>)
+                #define DRWAV_SUPPORT_SSE2
+            #endif
+        #endif
+
+        #if defined(DRWAV_SUPPORT_AVX2)
+            #include <immintrin.h>
+        #elif defined(DRWAV_SUPPORT_SSE2)
+            #include <emmintrin.h>
+        #endif
+    #endif
+
+    #if !defined(DRWAV_NO_NEON) && (defined(__ARM_NEON) || defined(__aarch64__) || defined(_M_ARM64))
+        #define DRWAV_SUPPORT_NEON
+        #include <arm_neon.h>
+    #endif
+#endif
+
 DRWAV_API void drwav_version(drwav_uint32* pMajor, drwav_uint32* pMinor, drwav_uint32* pRevision)
 {
     if (pMajor) {
@@ -5497,6 +5629,216 @@ DRWAV_API drwav_bool32 drwav_init_file_with_metadata_w(drwav* pWav, const wchar_
 #endif
 
 
+#ifndef DR_WAV_NO_MMAP
+#ifdef DRWAV_HAS_MMAP
+#if defined(_WIN32)
+/* This takes ownership of the file handle. */
+DRWAV_PRIVATE drwav_result drwav__map_file_handle(void* hFile, void** ppData, size_t* pDataSize)
+{
+    void* hMapping;
+    drwav_int64 fileSize;   /* Same layout as LARGE_INTEGER. */
+    void* pData;
+
+    if (hFile == DRWAV_WIN32_INVALID_HANDLE_VALUE) {
+        return DRWAV_DOES_NOT_EXIST;
+    }
+
+    if (!GetFileSizeEx(hFile, (union _LARGE_INTEGER*)&fileSize) || fileSize <= 0 || (drwav_uint64)fileSize > DRWAV_SIZE_MAX) {
+        CloseHandle(hFile);
+        return DRWAV_INVALID_FILE;
+    }
+
+    hMapping = CreateFileMappingA(hFile, NULL, DRWAV_WIN32_PAGE_READONLY, 0, 0, NULL);
+    CloseHandle(hFile);
+    if (hMapping == NULL) {
+        return DRWAV_ERROR;
+    }
+
+    /* The view keeps a reference to the mapping so the handle can be closed straight away. */
+    pData = MapViewOfFile(hMapping, DRWAV_WIN32_FILE_MAP_READ, 0, 0, 0);
+    CloseHandle(hMapping);
+    if (pData == NULL) {
+        return DRWAV_OUT_OF_MEMORY;
+    }
+
+    *ppData    = pData;
+    *pDataSize = (size_t)fileSize;
+
+    return DRWAV_SUCCESS;
+}
+#else
+/* This takes ownership of the file descriptor. */
+DRWAV_PRIVATE drwav_result drwav__map_file_descriptor(int fd, void** ppData, size_t* pDataSize)
+{
+    struct stat info;
+    void* pData;
+
+    if (fd == -1) {
+        return drwav_result_from_errno(errno);
+    }
+
+    if (fstat(fd, &info) != 0 || info.st_size <= 0 || (drwav_uint64)info.st_size > DRWAV_SIZE_MAX) {
+        close(fd);
+        return DRWAV_INVALID_FILE;
+    }
+
+    /* The mapping stays valid after the descriptor is closed. */
+    pData = mmap(NULL, (size_t)info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (pData == MAP_FAILED) {
+        return DRWAV_OUT_OF_MEMORY;
+    }
+
+    *ppData    = pData;
+    *pDataSize = (size_t)info.st_size;
+
+    return DRWAV_SUCCESS;
+}
+#endif
+
+DRWAV_PRIVATE drwav_result drwav__map_file(const char* filename, void** ppData, size_t* pDataSize)
+{
+#if defined(_WIN32)
+    return drwav__map_file_handle(CreateFileA(filename, DRWAV_WIN32_GENERIC_READ, DRWAV_WIN32_FILE_SHARE_READ, NULL, DRWAV_WIN32_OPEN_EXISTING, DRWAV_WIN32_FILE_ATTRIBUTE_NORMAL, NULL), ppData, pDataSize);
+#else
+    return drwav__map_file_descriptor(open(filename, O_RDONLY), ppData, pDataSize);
+#endif
+}
+
+#ifndef DR_WAV_NO_WCHAR
+DRWAV_PRIVATE drwav_result drwav__map_file_w(const wchar_t* filename, void** ppData, size_t* pDataSize, const drwav_allocation_callbacks* pAllocationCallbacks)
+{
+#if defined(_WIN32)
+    (void)pAllocationCallbacks;
+    return drwav__map_file_handle(CreateFileW(filename, DRWAV_WIN32_GENERIC_READ, DRWAV_WIN32_FILE_SHARE_READ, NULL, DRWAV_WIN32_OPEN_EXISTING, DRWAV_WIN32_FILE_ATTRIBUTE_NORMAL, NULL), ppData, pDataSize);
+#else
+    /* open() needs a multibyte path. This is converted with wcsrtombs() the same way as drwav_wfopen(). */
+    drwav_result result;
+    drwav_allocation_callbacks allocationCallbacks = drwav_copy_allocation_callbacks_or_defaults(pAllocationCallbacks);
+    mbstate_t mbs;
+    size_t lenMB;
+    const wchar_t* pFilePathTemp = filename;
+    char* pFilePathMB = NULL;
+
+    DRWAV_ZERO_OBJECT(&mbs);
+    lenMB = wcsrtombs(NULL, &pFilePathTemp, 0, &mbs);
+    if (lenMB == (size_t)-1) {
+        return drwav_result_from_errno(errno);
+    }
+
+    pFilePathMB = (char*)drwav__malloc_from_callbacks(lenMB + 1, &allocationCallbacks);
+    if (pFilePathMB == NULL) {
+        return DRWAV_OUT_OF_MEMORY;
+    }
+
+    pFilePathTemp = filename;
+    DRWAV_ZERO_OBJECT(&mbs);
+    wcsrtombs(pFilePathMB, &pFilePathTemp, lenMB + 1, &mbs);
+
+    result = drwav__map_file_descriptor(open(pFilePathMB, O_RDONLY), ppData, pDataSize);
+
+    drwav__free_from_callbacks(pFilePathMB, &allocationCallbacks);
+    return result;
+#endif
+}
+#endif
+
+DRWAV_PRIVATE void drwav__unmap_file(void* pData, size_t dataSize)
+{
+#if defined(_WIN32)
+    (void)dataSize;
+    UnmapViewOfFile(pData);
+#else
+    munmap(pData, dataSize);
+#endif
+}
+#endif  /* DRWAV_HAS_MMAP */
+
+DRWAV_API drwav_bool32 drwav_init_file_mmap(drwav* pWav, const char* filename, const drwav_allocation_callbacks* pAllocationCallbacks)
+{
+    return drwav_init_file_mmap_ex(pWav, filename, NULL, NULL, 0, pAllocationCallbacks);
+}
+
+#ifdef DRWAV_HAS_MMAP
+/* This takes ownership of the mapping. It is released if initialization fails. */
+DRWAV_PRIVATE drwav_bool32 drwav_init_file_mmap__internal(drwav* pWav, void* pData, size_t dataSize, drwav_chunk_proc onChunk, void* pChunkUserData, drwav_uint32 flags, const drwav_allocation_callbacks* pAllocationCallbacks)
+{
+    if (!drwav_init_memory_ex(pWav, pData, dataSize, onChunk, pChunkUserData, flags, pAllocationCallbacks)) {
+        drwav__unmap_file(pData, dataSize);
+        return DRWAV_FALSE;
+    }
+
+    /* drwav_uninit() will use this to release the mapping. */
+    pWav->pMappedFileData    = pData;
+    pWav->mappedFileDataSize = dataSize;
+
+    return DRWAV_TRUE;
+}
+#endif
+
+DRWAV_API drwav_bool32 drwav_init_file_mmap_ex(drwav* pWav, const char* filename, drwav_chunk_proc onChunk, void* pChunkUserData, drwav_uint32 flags, const drwav_allocation_callbacks* pAllocationCallbacks)
+{
+#ifdef DRWAV_HAS_MMAP
+    void* pData = NULL;
+    size_t dataSize = 0;
+
+    if (pWav == NULL || filename == NULL) {
+        return DRWAV_FALSE;
+    }
+
+    if (drwav__map_file(filename, &pData, &dataSize) != DRWAV_SUCCESS) {
+        return DRWAV_FALSE;
+    }
+
+    return drwav_init_file_mmap__internal(pWav, pData, dataSize, onChunk, pChunkUserData, flags, pAllocationCallbacks);
+#else
+    /* Memory mapping is not supported on this platform. */
+    (void)pWav;
+    (void)filename;
+    (void)onChunk;
+    (void)pChunkUserData;
+    (void)flags;
+    (void)pAllocationCallbacks;
+    return DRWAV_FALSE;
+#endif
+}
+
+#ifndef DR_WAV_NO_WCHAR
+DRWAV_API drwav_bool32 drwav_init_file_mmap_w(drwav* pWav, const wchar_t* filename, const drwav_allocation_callbacks* pAllocationCallbacks)
+{
+    return drwav_init_file_mmap_ex_w(pWav, filename, NULL, NULL, 0, pAllocationCallbacks);
+}
+
+DRWAV_API drwav_bool32 drwav_init_file_mmap_ex_w(drwav* pWav, const wchar_t* filename, drwav_chunk_proc onChunk, void* pChunkUserData, drwav_uint32 flags, const drwav_allocation_callbacks* pAllocationCallbacks)
+{
+#ifdef DRWAV_HAS_MMAP
+    void* pData = NULL;
+    size_t dataSize = 0;
+
+    if (pWav == NULL || filename == NULL) {
+        return DRWAV_FALSE;
+    }
+
+    if (drwav__map_file_w(filename, &pData, &dataSize, pAllocationCallbacks) != DRWAV_SUCCESS) {
+        return DRWAV_FALSE;
+    }
+
+    return drwav_init_file_mmap__internal(pWav, pData, dataSize, onChunk, pChunkUserData, flags, pAllocationCallbacks);
+#else
+    /* Memory mapping is not supported on this platform. */
+    (void)pWav;
+    (void)filename;
+    (void)onChunk;
+    (void)pChunkUserData;
+    (void)flags;
+    (void)pAllocationCallbacks;
+    return DRWAV_FALSE;
+#endif
+}
+#endif
+#endif  /* DR_WAV_NO_MMAP */
+
+
 DRWAV_PRIVATE drwav_bool32 drwav_init_file_write__internal_FILE(drwav* pWav, FILE* pFile, const drwav_data_format* pFormat, drwav_uint64 totalSampleCount, drwav_bool32 isSequential, const drwav_allocation_callbacks* pAllocationCallbacks)
 {
     drwav_bool32 result;
@@ -5897,6 +6239,13 @@ DRWAV_API drwav_result drwav_uninit(drwav* pWav)
     }
 #endif
 
+#ifdef DRWAV_HAS_MMAP
+    if (pWav->pMappedFileData != NULL) {
+        drwav__unmap_file(pWav->pMappedFileData, pWav->mappedFileDataSize);
+        pWav->pMappedFileData = NULL;
+    }
+#endif
+
     return result;
 }
 
@@ -6074,6 +6423,95 @@ DRWAV_API drwav_uint64 drwav_read_pcm_frames(drwav* pWav, drwav_uint64 framesToR
     return framesRead;
 }
 
+DRWAV_PRIVATE drwav_bool32 drwav__can_map_pcm_frames(drwav* pWav)
+{
+    drwav_bool32 isDataLE;
+
+    /* Mapping is only possible when the entire file is sitting in memory. */
+    if (pWav->onRead != drwav__on_read_memory) {
+        return DRWAV_FALSE;
+    }
+
+    if (drwav__is_compressed_format_tag(pWav->translatedFormatTag)) {
+        return DRWAV_FALSE;
+    }
+
+    /* The data needs to be in native-endian byte order already since we can't byte swap it in-place. */
+    isDataLE = DRWAV_TRUE;
+    if (drwav_is_container_be(pWav->container)) {
+        if (pWav->container != drwav_container_aiff || pWav->aiff.isLE == DRWAV_FALSE) {
+            isDataLE = DRWAV_FALSE;
+        }
+    }
+
+    if (isDataLE != (drwav_bool32)drwav__is_little_endian()) {
+        return DRWAV_FALSE;
+    }
+
+    /* Signed 8-bit AIFF needs to be converted to unsigned, just like drwav_read_pcm_frames(). */
+    if (pWav->container == drwav_container_aiff && pWav->bitsPerSample == 8 && pWav->aiff.isUnsigned == DRWAV_FALSE) {
+        return DRWAV_FALSE;
+    }
+
+    return DRWAV_TRUE;
+}
+
+DRWAV_API drwav_uint64 drwav_map_pcm_frames(drwav* pWav, drwav_uint64 framesToMap, const void** ppFramesOut)
+{
+    drwav_uint32 bytesPerFrame;
+    drwav_uint64 framesRemainingInFile;
+    drwav_uint64 bytesAvailable;
+    drwav_uint64 bytesToMap;
+
+    if (ppFramesOut == NULL) {
+        return 0;
+    }
+
+    *ppFramesOut = NULL;
+
+    if (pWav == NULL || framesToMap == 0) {
+        return 0;
+    }
+
+    if (!drwav__can_map_pcm_frames(pWav)) {
+        return 0;
+    }
+
+    bytesPerFrame = drwav_get_bytes_per_pcm_frame(pWav);
+    if (bytesPerFrame == 0) {
+        return 0;
+    }
+
+    framesRemainingInFile = pWav->totalPCMFrameCount - pWav->readCursorInPCMFrames;
+    if (framesToMap > framesRemainingInFile) {
+        framesToMap = framesRemainingInFile;
+    }
+
+    /* Never hand out a pointer that goes beyond the end of the data chunk or the buffer itself. */
+    bytesAvailable = drwav_min(pWav->bytesRemaining, (drwav_uint64)(pWav->memoryStream.dataSize - pWav->memoryStream.currentReadPos));
+    if (framesToMap > bytesAvailable / bytesPerFrame) {
+        framesToMap = bytesAvailable / bytesPerFrame;
+    }
+
+    if (framesToMap > DRWAV_SIZE_MAX / bytesPerFrame) {
+        framesToMap = DRWAV_SIZE_MAX / bytesPerFrame;
+    }
+
+    if (framesToMap == 0) {
+        return 0;
+    }
+
+    bytesToMap = framesToMap * bytesPerFrame;
+
+    *ppFramesOut = pWav->memoryStream.data + pWav->memoryStream.currentReadPos;
+
+    pWav->memoryStream.currentReadPos += (size_t)bytesToMap;
+    pWav->bytesRemaining              -= bytesToMap;
+    pWav->readCursorInPCMFrames       += framesToMap;
+
+    return framesToMap;
+}
+
 
 
 DRWAV_PRIVATE drwav_bool32 drwav_seek_to_first_pcm_frame(drwav* pWav)
@@ -6103,6 +6541,61 @@ DRWAV_PRIVATE drwav_bool32 drwav_seek_to_first_pcm_frame(drwav* pWav)
     return DRWAV_TRUE;
 }
 
+DRWAV_PRIVATE drwav_uint64 drwav__adpcm_frames_per_block(drwav* pWav)
+{
+    /*
+    ADPCM blocks are a fixed size and each one starts with a header containing the initial decoder state which means we can jump
+    straight to any block. The frame counts here need to match the way the decoders consume a block. Returns 0 if the layout isn't
+    something we can safely jump around in, in which case the caller needs to fall back to decoding from the start.
+    */
+    if (pWav->channels != 1 && pWav->channels != 2) {
+        return 0;
+    }
+
+    if (pWav->translatedFormatTag == DR_WAVE_FORMAT_ADPCM) {
+        if (pWav->fmt.blockAlign <= 7*pWav->channels) {
+            return 0;
+        }
+
+        /* 2 frames in the header, then one byte per frame for stereo and two frames per byte for mono. */
+        return 2 + ((drwav_uint64)(pWav->fmt.blockAlign - 7*pWav->channels) * 2) / pWav->channels;
+    }
+
+    if (pWav->translatedFormatTag == DR_WAVE_FORMAT_DVI_ADPCM) {
+        if (pWav->fmt.blockAlign <= 4*pWav->channels || ((pWav->fmt.blockAlign - 4*pWav->channels) % (4*pWav->channels)) != 0) {
+            return 0;
+        }
+
+        /* 1 frame in the header, then 8 frames for each group of 4 bytes per channel. */
+        return 1 + ((drwav_uint64)(pWav->fmt.blockAlign - 4*pWav->channels) / (4*pWav->channels)) * 8;
+    }
+
+    return 0;
+}
+
+DRWAV_PRIVATE drwav_bool32 drwav__seek_to_adpcm_block(drwav* pWav, drwav_uint64 blockIndex, drwav_uint64 framesPerBlock)
+{
+    drwav_uint64 blockOffset = blockIndex * pWav->fmt.blockAlign;
+
+    DRWAV_ASSERT(blockOffset < pWav->dataChunkDataSize);
+
+    if (!drwav__seek_from_start(pWav->onSeek, pWav->dataChunkDataPos + blockOffset, pWav->pUserData)) {
+        return DRWAV_FALSE;
+    }
+
+    /* Clearing the cached state forces the decoder to load the header of the block on the next read. */
+    if (pWav->translatedFormatTag == DR_WAVE_FORMAT_ADPCM) {
+        DRWAV_ZERO_OBJECT(&pWav->msadpcm);
+    } else {
+        DRWAV_ZERO_OBJECT(&pWav->ima);
+    }
+
+    pWav->readCursorInPCMFrames = blockIndex * framesPerBlock;
+    pWav->bytesRemaining = pWav->dataChunkDataSize - blockOffset;
+
+    return DRWAV_TRUE;
+}
+
 DRWAV_API drwav_bool32 drwav_seek_to_pcm_frame(drwav* pWav, drwav_uint64 targetFrameIndex)
 {
     /* Seeking should be compatible with wave files > 2GB. */
@@ -6131,13 +6624,18 @@ DRWAV_API drwav_bool32 drwav_seek_to_pcm_frame(drwav* pWav, drwav_uint64 targetF
     to seek back to the start.
     */
     if (drwav__is_compressed_format_tag(pWav->translatedFormatTag)) {
-        /* TODO: This can be optimized. */
+        drwav_uint64 framesPerBlock = drwav__adpcm_frames_per_block(pWav);
 
         /*
-        If we're seeking forward it's simple - just keep reading samples until we hit the sample we're requesting. If we're seeking backwards,
-        we first need to seek back to the start and then just do the same thing as a forward seek.
+        If the target is outside of the block we're currently sitting in we can jump straight to the start of the block that contains
+        it. Otherwise, if we're seeking forward it's simple - just keep reading samples until we hit the sample we're requesting. If
+        we're seeking backwards, we first need to seek back to the start and then just do the same thing as a forward seek.
         */
-        if (targetFrameIndex < pWav->readCursorInPCMFrames) {
+        if (framesPerBlock > 0 && (targetFrameIndex < pWav->readCursorInPCMFrames || (targetFrameIndex / framesPerBlock) != (pWav->readCursorInPCMFrames / framesPerBlock)) && (targetFrameIndex / framesPerBlock) * pWav->fmt.blockAlign < pWav->dataChunkDataSize) {
+            if (!drwav__seek_to_adpcm_block(pWav, targetFrameIndex / framesPerBlock, framesPerBlock)) {
+                return DRWAV_FALSE;
+            }
+        } else if (targetFrameIndex < pWav->readCursorInPCMFrames) {
             if (!drwav_seek_to_first_pcm_frame(pWav)) {
                 return DRWAV_FALSE;
             }
@@ -6737,17 +7235,236 @@ DRWAV_PRIVATE drwav_uint64 drwav_read_pcm_frames_s16__ima(drwav* pWav, drwav_uin
 
 
 #ifndef DR_WAV_NO_CONVERSION_API
-static const unsigned short g_drwavAlawTable[256] = {
-    0xEA80, 0xEB80, 0xE880, 0xE980, 0xEE80, 0xEF80, 0xEC80, 0xED80, 0xE280, 0xE380, 0xE080, 0xE180, 0xE680, 0xE780, 0xE480, 0xE580,
-    0xF540, 0xF5C0, 0xF440, 0xF4C0, 0xF740, 0xF7C0, 0xF640, 0xF6C0, 0xF140, 0xF1C0, 0xF040, 0xF0C0, 0xF340, 0xF3C0, 0xF240, 0xF2C0,
-    0xAA00, 0xAE00, 0xA200, 0xA600, 0xBA00, 0xBE00, 0xB200, 0xB600, 0x8A00, 0x8E00, 0x8200, 0x8600, 0x9A00, 0x9E00, 0x9200, 0x9600,
-    0xD500, 0xD700, 0xD100, 0xD300, 0xDD00, 0xDF00, 0xD900, 0xDB00, 0xC500, 0xC700, 0xC100, 0xC300, 0xCD00, 0xCF00, 0xC900, 0xCB00,
-    0xFEA8, 0xFEB8, 0xFE88, 0xFE98, 0xFEE8, 0xFEF8, 0xFEC8, 0xFED8, 0xFE28, 0xFE38, 0xFE08, 0xFE18, 0xFE68, 0xFE78, 0xFE48, 0xFE58,
-    0xFFA8, 0xFFB8, 0xFF88, 0xFF98, 0xFFE8, 0xFFF8, 0xFFC8, 0xFFD8, 0xFF28, 0xFF38, 0xFF08, 0xFF18, 0xFF68, 0xFF78, 0xFF48, 0xFF58,
-    0xFAA0, 0xFAE0, 0xFA20, 0xFA60, 0xFBA0, 0xFBE0, 0xFB20, 0xFB60, 0xF8A0, 0xF8E0, 0xF820, 0xF860, 0xF9A0, 0xF9E0, 0xF920, 0xF960,
-    0xFD50, 0xFD70, 0xFD10, 0xFD30, 0xFDD0, 0xFDF0, 0xFD90, 0xFDB0, 0xFC50, 0xFC70, 0xFC10, 0xFC30, 0xFCD0, 0xFCF0, 0xFC90, 0xFCB0,
-    0x1580, 0x1480, 0x1780, 0x1680, 0x1180, 0x1080, 0x1380, 0x1280, 0x1D80, 0x1C80, 0x1F80, 0x1E80, 0x1980, 0x1880, 0x1B80, 0x1A80,
-    0x0AC0, 0x0A40, 0x0BC0, 0x0B40, 0x08C0, 0x0840, 0x09C0, 0x0940, 0x0EC0, 0x0E40, 0x0FC0, 0x0F40, 0x0CC0, 0x0C40, 0x0DC0, 0x0D40,
+/* CPU caps. */
+#if defined(__has_feature)
+    #if __has_feature(thread_sanitizer)
+        #define DRWAV_NO_THREAD_SANITIZE __attribute__((no_sanitize("thread")))
+    #else
+        #define DRWAV_NO_THREAD_SANITIZE
+    #endif
+#else
+    #define DRWAV_NO_THREAD_SANITIZE
+#endif
+
+#if defined(DRWAV_SUPPORT_SSE2) || defined(DRWAV_SUPPORT_AVX2)
+    #if defined(_MSC_VER) && !defined(__clang__)
+        #if _MSC_VER >= 1400
+            #include <intrin.h>
+            static DRWAV_INLINE void drwav__cpuid(int info[4], int fid)
+            {
+                #if _MSC_VER >= 1600
+                    __cpuidex(info, fid, 0);
+                #else
+                    __cpuid(info, fid);
+                #endif
+            }
+        #else
+            #define DRWAV_NO_CPUID
+        #endif
+    #else
+        #if defined(__GNUC__) || defined(__clang__)
+            static DRWAV_INLINE void drwav__cpuid(int info[4], int fid)
+            {
+                /* Same as dr_flac. The ebx register needs to be saved and restored manually when compiling with -fPIC on 32-bit. */
+                #if defined(DRWAV_X86) && defined(__PIC__)
+                    __asm__ __volatile__ (
+                        "xchg{l} {%%}ebx, %k1;"
+                        "cpuid;"
+                        "xchg{l} {%%}ebx, %k1;"
+                        : "=a"(info[0]), "=&r"(info[1]), "=c"(info[2]), "=d"(info[3]) : "a"(fid), "c"(0)
+                    );
+                #else
+                    __asm__ __volatile__ (
+                        "cpuid" : "=a"(info[0]), "=b"(info[1]), "=c"(info[2]), "=d"(info[3]) : "a"(fid), "c"(0)
+                    );
+                #endif
+            }
+        #else
+            #define DRWAV_NO_CPUID
+        #endif
+    #endif
+#else
+    #define DRWAV_NO_CPUID
+#endif
+
+static DRWAV_INLINE drwav_bool32 drwav_has_sse2(void)
+{
+#if defined(DRWAV_SUPPORT_SSE2)
+    #if defined(DRWAV_X64)
+        return DRWAV_TRUE;    /* 64-bit targets always support SSE2. */
+    #elif (defined(_M_IX86_FP) && _M_IX86_FP == 2) || defined(__SSE2__)
+        return DRWAV_TRUE;    /* If the compiler is allowed to freely generate SSE2 code we can assume support. */
+    #elif defined(DRWAV_NO_CPUID)
+        return DRWAV_FALSE;
+    #else
+        int info[4];
+        drwav__cpuid(info, 1);
+        return (info[3] & (1 << 26)) != 0;
+    #endif
+#else
+    return DRWAV_FALSE;       /* No compiler support. */
+#endif
+}
+
+static DRWAV_INLINE drwav_bool32 drwav_has_avx2(void)
+{
+#if defined(DRWAV_SUPPORT_AVX2)
+    #if defined(__AVX2__)
+        return DRWAV_TRUE;    /* If the compiler is allowed to freely generate AVX2 code we can assume support. */
+    #elif defined(DRWAV_NO_CPUID)
+        return DRWAV_FALSE;
+    #else
+        int info[4];
+        drwav_uint32 xcr0;
+
+        drwav__cpuid(info, 0);
+        if (info[0] < 7) {
+            return DRWAV_FALSE;
+        }
+
+        /* AVX registers can't be used unless the OS is saving them. This needs OSXSAVE for XGETBV. */
+        drwav__cpuid(info, 1);
+        if ((info[2] & (1 << 27)) == 0) {
+            return DRWAV_FALSE;
+        }
+
+        #if defined(_MSC_VER) && !defined(__clang__)
+            xcr0 = (drwav_uint32)_xgetbv(0);
+        #else
+        {
+            drwav_uint32 hi;
+            __asm__ __volatile__ (".byte 0x0f, 0x01, 0xd0" : "=a"(xcr0), "=d"(hi) : "c"(0));    /* xgetbv */
+            (void)hi;
+        }
+        #endif
+
+        if ((xcr0 & 0x06) != 0x06) {
+            return DRWAV_FALSE;   /* The OS is not saving the XMM and YMM registers. */
+        }
+
+        drwav__cpuid(info, 7);
+        return (info[1] & (1 << 5)) != 0;
+    #endif
+#else
+    return DRWAV_FALSE;       /* No compiler support. */
+#endif
+}
+
+static DRWAV_INLINE drwav_bool32 drwav_has_neon(void)
+{
+#if defined(DRWAV_SUPPORT_NEON)
+    return DRWAV_TRUE;        /* NEON support is only enabled when the compiler is allowed to freely generate NEON code. */
+#else
+    return DRWAV_FALSE;       /* No compiler support. */
+#endif
+}
+
+static drwav_bool32 drwav__gIsSSE2Supported = DRWAV_FALSE;
+static drwav_bool32 drwav__gIsAVX2Supported = DRWAV_FALSE;
+static drwav_bool32 drwav__gIsNEONSupported = DRWAV_FALSE;
+
+/*
+The conversion routines are public so this can't be done at initialization time like dr_flac does. Instead it's done lazily
+by each conversion routine that has a SIMD path. CPU caps never change for a running process so the race is benign, which is
+why thread sanitization is disabled.
+*/
+DRWAV_NO_THREAD_SANITIZE static void drwav__init_cpu_caps(void)
+{
+    static drwav_bool32 isCPUCapsInitialized = DRWAV_FALSE;
+
+    if (!isCPUCapsInitialized) {
+        drwav__gIsSSE2Supported = drwav_has_sse2();
+        drwav__gIsAVX2Supported = drwav_has_avx2();
+        drwav__gIsNEONSupported = drwav_has_neon();
+
+        isCPUCapsInitialized = DRWAV_TRUE;
+    }
+}
+
+#if defined(DRWAV_SUPPORT_SSE2)
+/*
+Unpacks four 24-bit samples from the low 12 bytes of x into the upper 24 bits of each 32-bit lane. SSE2 has no byte shuffle
+so this is done with byte shifts instead.
+*/
+static DRWAV_INLINE __m128i drwav__mm_unpack_s24(__m128i x)
+{
+    __m128i s01 = _mm_unpacklo_epi32(x, _mm_srli_si128(x, 3));
+    __m128i s23 = _mm_unpacklo_epi32(_mm_srli_si128(x, 6), _mm_srli_si128(x, 9));
+    return _mm_slli_epi32(_mm_unpacklo_epi64(s01, s23), 8);
+}
+#endif
+
+#if defined(DRWAV_SUPPORT_AVX2)
+/* Unpacks eight 24-bit samples into the upper 24 bits of each 32-bit lane. This reads 28 bytes. */
+static DRWAV_INLINE __m256i drwav__mm256_unpack_s24(const drwav_uint8* pIn)
+{
+    const __m256i shuffle = _mm256_setr_epi8(
+        -1, 0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11,
+        -1, 0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11
+    );
+    __m256i x = _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_loadu_si128((const __m128i*)pIn)), _mm_loadu_si128((const __m128i*)(pIn + 12)), 1);
+    return _mm256_shuffle_epi8(x, shuffle);
+}
+#endif
+
+#if defined(DRWAV_SUPPORT_NEON)
+/* Unpacks eight 24-bit samples into the upper 24 bits of two sets of 32-bit lanes, and also returns the upper 16 bits of each sample. */
+static DRWAV_INLINE uint16x8_t drwav__neon_unpack_s24(const drwav_uint8* pIn, uint32x4_t* pLo, uint32x4_t* pHi)
+{
+    uint8x8x3_t x    = vld3_u8(pIn);
+    uint16x8_t  lo16 = vshll_n_u8(x.val[0], 8);
+    uint16x8_t  hi16 = vorrq_u16(vshll_n_u8(x.val[2], 8), vmovl_u8(x.val[1]));
+
+    *pLo = vorrq_u32(vshll_n_u16(vget_low_u16 (hi16), 16), vmovl_u16(vget_low_u16 (lo16)));
+    *pHi = vorrq_u32(vshll_n_u16(vget_high_u16(hi16), 16), vmovl_u16(vget_high_u16(lo16)));
+
+    return hi16;
+}
+#endif
+
+/*
+Used by the conversion routines to get at the raw sample data. For memory backed streams this points straight into the
+buffer rather than copying the data into pTempBuffer first. pTempBuffer must be large enough for framesToRead frames.
+*/
+DRWAV_PRIVATE drwav_uint64 drwav__read_or_map_pcm_frames(drwav* pWav, drwav_uint64 framesToRead, drwav_uint8* pTempBuffer, const drwav_uint8** ppFramesOut)
+{
+    const void* pMappedFrames;
+    drwav_uint64 framesMapped;
+    drwav_uint32 bytesPerSample;
+
+    /*
+    The floating point conversion routines cast the input pointer so we need to make sure it's suitably aligned for that. This
+    is always the case for sane files, but it's not guaranteed so we'll fall back to a copy if necessary.
+    */
+    bytesPerSample = drwav_get_bytes_per_pcm_frame(pWav) / pWav->channels;
+    if (pWav->onRead == drwav__on_read_memory && (bytesPerSample == 2 || bytesPerSample == 4 || bytesPerSample == 8)) {
+        if (((drwav_uintptr)(pWav->memoryStream.data + pWav->memoryStream.currentReadPos) & (bytesPerSample - 1)) != 0) {
+            *ppFramesOut = pTempBuffer;
+            return drwav_read_pcm_frames(pWav, framesToRead, pTempBuffer);
+        }
+    }
+
+    framesMapped = drwav_map_pcm_frames(pWav, framesToRead, &pMappedFrames);
+    if (pMappedFrames != NULL) {
+        *ppFramesOut = (const drwav_uint8*)pMappedFrames;
+        return framesMapped;
+    }
+
+    *ppFramesOut = pTempBuffer;
+    return drwav_read_pcm_frames(pWav, framesToRead, pTempBuffer);
+}
+
+static const unsigned short g_drwavAlawTable[256] = {
+    0xEA80, 0xEB80, 0xE880, 0xE980, 0xEE80, 0xEF80, 0xEC80, 0xED80, 0xE280, 0xE380, 0xE080, 0xE180, 0xE680, 0xE780, 0xE480, 0xE580,
+    0xF540, 0xF5C0, 0xF440, 0xF4C0, 0xF740, 0xF7C0, 0xF640, 0xF6C0, 0xF140, 0xF1C0, 0xF040, 0xF0C0, 0xF340, 0xF3C0, 0xF240, 0xF2C0,
+    0xAA00, 0xAE00, 0xA200, 0xA600, 0xBA00, 0xBE00, 0xB200, 0xB600, 0x8A00, 0x8E00, 0x8200, 0x8600, 0x9A00, 0x9E00, 0x9200, 0x9600,
+    0xD500, 0xD700, 0xD100, 0xD300, 0xDD00, 0xDF00, 0xD900, 0xDB00, 0xC500, 0xC700, 0xC100, 0xC300, 0xCD00, 0xCF00, 0xC900, 0xCB00,
+    0xFEA8, 0xFEB8, 0xFE88, 0xFE98, 0xFEE8, 0xFEF8, 0xFEC8, 0xFED8, 0xFE28, 0xFE38, 0xFE08, 0xFE18, 0xFE68, 0xFE78, 0xFE48, 0xFE58,
+    0xFFA8, 0xFFB8, 0xFF88, 0xFF98, 0xFFE8, 0xFFF8, 0xFFC8, 0xFFD8, 0xFF28, 0xFF38, 0xFF08, 0xFF18, 0xFF68, 0xFF78, 0xFF48, 0xFF58,
+    0xFAA0, 0xFAE0, 0xFA20, 0xFA60, 0xFBA0, 0xFBE0, 0xFB20, 0xFB60, 0xF8A0, 0xF8E0, 0xF820, 0xF860, 0xF9A0, 0xF9E0, 0xF920, 0xF960,
+    0xFD50, 0xFD70, 0xFD10, 0xFD30, 0xFDD0, 0xFDF0, 0xFD90, 0xFDB0, 0xFC50, 0xFC70, 0xFC10, 0xFC30, 0xFCD0, 0xFCF0, 0xFC90, 0xFCB0,
+    0x1580, 0x1480, 0x1780, 0x1680, 0x1180, 0x1080, 0x1380, 0x1280, 0x1D80, 0x1C80, 0x1F80, 0x1E80, 0x1980, 0x1880, 0x1B80, 0x1A80,
+    0x0AC0, 0x0A40, 0x0BC0, 0x0B40, 0x08C0, 0x0840, 0x09C0, 0x0940, 0x0EC0, 0x0E40, 0x0FC0, 0x0F40, 0x0CC0, 0x0C40, 0x0DC0, 0x0D40,
     0x5600, 0x5200, 0x5E00, 0x5A00, 0x4600, 0x4200, 0x4E00, 0x4A00, 0x7600, 0x7200, 0x7E00, 0x7A00, 0x6600, 0x6200, 0x6E00, 0x6A00,
     0x2B00, 0x2900, 0x2F00, 0x2D00, 0x2300, 0x2100, 0x2700, 0x2500, 0x3B00, 0x3900, 0x3F00, 0x3D00, 0x3300, 0x3100, 0x3700, 0x3500,
     0x0158, 0x0148, 0x0178, 0x0168, 0x0118, 0x0108, 0x0138, 0x0128, 0x01D8, 0x01C8, 0x01F8, 0x01E8, 0x0198, 0x0188, 0x01B8, 0x01A8,
@@ -6800,9 +7517,7 @@ DRWAV_PRIVATE void drwav__pcm_to_s16(drwav_int16* pOut, const drwav_uint8* pIn,
 
     /* Slightly more optimal implementation for common formats. */
     if (bytesPerSample == 2) {
-        for (i = 0; i < totalSampleCount; ++i) {
-           *pOut++ = ((const drwav_int16*)pIn)[i];
-        }
+        DRWAV_COPY_MEMORY(pOut, pIn, totalSampleCount * sizeof(*pOut));
         return;
     }
     if (bytesPerSample == 3) {
@@ -6885,7 +7600,8 @@ DRWAV_PRIVATE drwav_uint64 drwav_read_pcm_frames_s16__pcm(drwav* pWav, drwav_uin
 
     while (framesToRead > 0) {
         drwav_uint64 framesToReadThisIteration = drwav_min(framesToRead, sizeof(sampleData)/bytesPerFrame);
-        drwav_uint64 framesRead = drwav_read_pcm_frames(pWav, framesToReadThisIteration, sampleData);
+        const drwav_uint8* pSampleData;
+        drwav_uint64 framesRead = drwav__read_or_map_pcm_frames(pWav, framesToReadThisIteration, sampleData, &pSampleData);
         if (framesRead == 0) {
             break;
         }
@@ -6899,7 +7615,7 @@ DRWAV_PRIVATE drwav_uint64 drwav_read_pcm_frames_s16__pcm(drwav* pWav, drwav_uin
             break;
         }
 
-        drwav__pcm_to_s16(pBufferOut, sampleData, (size_t)samplesRead, bytesPerSample);
+        drwav__pcm_to_s16(pBufferOut, pSampleData, (size_t)samplesRead, bytesPerSample);
 
         pBufferOut      += samplesRead;
         framesToRead    -= framesRead;
@@ -6935,7 +7651,8 @@ DRWAV_PRIVATE drwav_uint64 drwav_read_pcm_frames_s16__ieee(drwav* pWav, drwav_ui
 
     while (framesToRead > 0) {
         drwav_uint64 framesToReadThisIteration = drwav_min(framesToRead, sizeof(sampleData)/bytesPerFrame);
-        drwav_uint64 framesRead = drwav_read_pcm_frames(pWav, framesToReadThisIteration, sampleData);
+        const drwav_uint8* pSampleData;
+        drwav_uint64 framesRead = drwav__read_or_map_pcm_frames(pWav, framesToReadThisIteration, sampleData, &pSampleData);
         if (framesRead == 0) {
             break;
         }
@@ -6949,7 +7666,7 @@ DRWAV_PRIVATE drwav_uint64 drwav_read_pcm_frames_s16__ieee(drwav* pWav, drwav_ui
             break;
         }
 
-        drwav__ieee_to_s16(pBufferOut, sampleData, (size_t)samplesRead, bytesPerSample);    /* Safe cast. */
+        drwav__ieee_to_s16(pBufferOut, pSampleData, (size_t)samplesRead, bytesPerSample);    /* Safe cast. */
 
         pBufferOut      += samplesRead;
         framesToRead    -= framesRead;
@@ -6985,7 +7702,8 @@ DRWAV_PRIVATE drwav_uint64 drwav_read_pcm_frames_s16__alaw(drwav* pWav, drwav_ui
 
     while (framesToRead > 0) {
         drwav_uint64 framesToReadThisIteration = drwav_min(framesToRead, sizeof(sampleData)/bytesPerFrame);
-        drwav_uint64 framesRead = drwav_read_pcm_frames(pWav, framesToReadThisIteration, sampleData);
+        const drwav_uint8* pSampleData;
+        drwav_uint64 framesRead = drwav__read_or_map_pcm_frames(pWav, framesToReadThisIteration, sampleData, &pSampleData);
         if (framesRead == 0) {
             break;
         }
@@ -6999,7 +7717,7 @@ DRWAV_PRIVATE drwav_uint64 drwav_read_pcm_frames_s16__alaw(drwav* pWav, drwav_ui
             break;
         }
 
-        drwav_alaw_to_s16(pBufferOut, sampleData, (size_t)samplesRead);
+        drwav_alaw_to_s16(pBufferOut, pSampleData, (size_t)samplesRead);
 
         /*
         For some reason libsndfile seems to be returning samples of the opposite sign for a-law, but only
@@ -7052,7 +7770,8 @@ DRWAV_PRIVATE drwav_uint64 drwav_read_pcm_frames_s16__mulaw(drwav* pWav, drwav_u
 
     while (framesToRead > 0) {
         drwav_uint64 framesToReadThisIteration = drwav_min(framesToRead, sizeof(sampleData)/bytesPerFrame);
-        drwav_uint64 framesRead = drwav_read_pcm_frames(pWav, framesToReadThisIteration, sampleData);
+        const drwav_uint8* pSampleData;
+        drwav_uint64 framesRead = drwav__read_or_map_pcm_frames(pWav, framesToReadThisIteration, sampleData, &pSampleData);
         if (framesRead == 0) {
             break;
         }
@@ -7066,7 +7785,7 @@ DRWAV_PRIVATE drwav_uint64 drwav_read_pcm_frames_s16__mulaw(drwav* pWav, drwav_u
             break;
         }
 
-        drwav_mulaw_to_s16(pBufferOut, sampleData, (size_t)samplesRead);
+        drwav_mulaw_to_s16(pBufferOut, pSampleData, (size_t)samplesRead);
 
         /*
         Just like with alaw, for some reason the signs between libsndfile and dr_wav are opposite. We just need to
@@ -7154,7 +7873,7 @@ DRWAV_API drwav_uint64 drwav_read_pcm_frames_s16be(drwav* pWav, drwav_uint64 fra
 }
 
 
-DRWAV_API void drwav_u8_to_s16(drwav_int16* pOut, const drwav_uint8* pIn, size_t sampleCount)
+DRWAV_PRIVATE void drwav_u8_to_s16__scalar(drwav_int16* pOut, const drwav_uint8* pIn, size_t sampleCount)
 {
     int r;
     size_t i;
@@ -7166,7 +7885,87 @@ DRWAV_API void drwav_u8_to_s16(drwav_int16* pOut, const drwav_uint8* pIn, size_t
     }
 }
 
-DRWAV_API void drwav_s24_to_s16(drwav_int16* pOut, const drwav_uint8* pIn, size_t sampleCount)
+#if defined(DRWAV_SUPPORT_AVX2)
+DRWAV_PRIVATE void drwav_u8_to_s16__avx2(drwav_int16* pOut, const drwav_uint8* pIn, size_t sampleCount)
+{
+    size_t i;
+    const __m256i bias = _mm256_set1_epi8((char)0x80);
+    const __m256i zero = _mm256_setzero_si256();
+
+    /* (x - 128) << 8 is the same as placing (x ^ 0x80) in the upper byte of each 16-bit lane. */
+    for (i = 0; i + 32 <= sampleCount; i += 32) {
+        __m256i x  = _mm256_xor_si256(_mm256_loadu_si256((const __m256i*)(pIn + i)), bias);
+        __m256i lo = _mm256_unpacklo_epi8(zero, x);
+        __m256i hi = _mm256_unpackhi_epi8(zero, x);
+        _mm256_storeu_si256((__m256i*)(pOut + i +  0), _mm256_permute2x128_si256(lo, hi, 0x20));
+        _mm256_storeu_si256((__m256i*)(pOut + i + 16), _mm256_permute2x128_si256(lo, hi, 0x31));
+    }
+
+    drwav_u8_to_s16__scalar(pOut + i, pIn + i, sampleCount - i);
+}
+#endif
+
+#if defined(DRWAV_SUPPORT_SSE2)
+DRWAV_PRIVATE void drwav_u8_to_s16__sse2(drwav_int16* pOut, const drwav_uint8* pIn, size_t sampleCount)
+{
+    size_t i;
+    const __m128i bias = _mm_set1_epi8((char)0x80);
+    const __m128i zero = _mm_setzero_si128();
+
+    /* (x - 128) << 8 is the same as placing (x ^ 0x80) in the upper byte of each 16-bit lane. */
+    for (i = 0; i + 16 <= sampleCount; i += 16) {
+        __m128i x = _mm_xor_si128(_mm_loadu_si128((const __m128i*)(pIn + i)), bias);
+        _mm_storeu_si128((__m128i*)(pOut + i + 0), _mm_unpacklo_epi8(zero, x));
+        _mm_storeu_si128((__m128i*)(pOut + i + 8), _mm_unpackhi_epi8(zero, x));
+    }
+
+    drwav_u8_to_s16__scalar(pOut + i, pIn + i, sampleCount - i);
+}
+#endif
+
+#if defined(DRWAV_SUPPORT_NEON)
+DRWAV_PRIVATE void drwav_u8_to_s16__neon(drwav_int16* pOut, const drwav_uint8* pIn, size_t sampleCount)
+{
+    size_t i;
+    const uint8x8_t bias = vdup_n_u8(0x80);
+
+    for (i = 0; i + 8 <= sampleCount; i += 8) {
+        vst1q_s16(pOut + i, vreinterpretq_s16_u16(vshll_n_u8(veor_u8(vld1_u8(pIn + i), bias), 8)));
+    }
+
+    drwav_u8_to_s16__scalar(pOut + i, pIn + i, sampleCount - i);
+}
+#endif
+
+DRWAV_API void drwav_u8_to_s16(drwav_int16* pOut, const drwav_uint8* pIn, size_t sampleCount)
+{
+    drwav__init_cpu_caps();
+
+#if defined(DRWAV_SUPPORT_AVX2)
+    if (drwav__gIsAVX2Supported) {
+        drwav_u8_to_s16__avx2(pOut, pIn, sampleCount);
+        return;
+    }
+#endif
+
+#if defined(DRWAV_SUPPORT_SSE2)
+    if (drwav__gIsSSE2Supported) {
+        drwav_u8_to_s16__sse2(pOut, pIn, sampleCount);
+        return;
+    }
+#endif
+
+#if defined(DRWAV_SUPPORT_NEON)
+    if (drwav__gIsNEONSupported) {
+        drwav_u8_to_s16__neon(pOut, pIn, sampleCount);
+        return;
+    }
+#endif
+
+    drwav_u8_to_s16__scalar(pOut, pIn, sampleCount);
+}
+
+DRWAV_PRIVATE void drwav_s24_to_s16__scalar(drwav_int16* pOut, const drwav_uint8* pIn, size_t sampleCount)
 {
     int r;
     size_t i;
@@ -7177,7 +7976,80 @@ DRWAV_API void drwav_s24_to_s16(drwav_int16* pOut, const drwav_uint8* pIn, size_
     }
 }
 
-DRWAV_API void drwav_s32_to_s16(drwav_int16* pOut, const drwav_int32* pIn, size_t sampleCount)
+#if defined(DRWAV_SUPPORT_AVX2)
+DRWAV_PRIVATE void drwav_s24_to_s16__avx2(drwav_int16* pOut, const drwav_uint8* pIn, size_t sampleCount)
+{
+    size_t i;
+
+    for (i = 0; i + 18 <= sampleCount; i += 16) {
+        __m256i a = _mm256_srai_epi32(drwav__mm256_unpack_s24(pIn + i*3 +  0), 16);
+        __m256i b = _mm256_srai_epi32(drwav__mm256_unpack_s24(pIn + i*3 + 24), 16);
+        _mm256_storeu_si256((__m256i*)(pOut + i), _mm256_permute4x64_epi64(_mm256_packs_epi32(a, b), 0xD8));
+    }
+
+    drwav_s24_to_s16__scalar(pOut + i, pIn + i*3, sampleCount - i);
+}
+#endif
+
+#if defined(DRWAV_SUPPORT_SSE2)
+DRWAV_PRIVATE void drwav_s24_to_s16__sse2(drwav_int16* pOut, const drwav_uint8* pIn, size_t sampleCount)
+{
+    size_t i;
+
+    for (i = 0; i + 10 <= sampleCount; i += 8) {
+        __m128i a = _mm_srai_epi32(drwav__mm_unpack_s24(_mm_loadu_si128((const __m128i*)(pIn + i*3 +  0))), 16);
+        __m128i b = _mm_srai_epi32(drwav__mm_unpack_s24(_mm_loadu_si128((const __m128i*)(pIn + i*3 + 12))), 16);
+        _mm_storeu_si128((__m128i*)(pOut + i), _mm_packs_epi32(a, b));
+    }
+
+    drwav_s24_to_s16__scalar(pOut + i, pIn + i*3, sampleCount - i);
+}
+#endif
+
+#if defined(DRWAV_SUPPORT_NEON)
+DRWAV_PRIVATE void drwav_s24_to_s16__neon(drwav_int16* pOut, const drwav_uint8* pIn, size_t sampleCount)
+{
+    size_t i;
+    uint32x4_t lo;
+    uint32x4_t hi;
+
+    for (i = 0; i + 8 <= sampleCount; i += 8) {
+        vst1q_s16(pOut + i, vreinterpretq_s16_u16(drwav__neon_unpack_s24(pIn + i*3, &lo, &hi)));
+    }
+
+    drwav_s24_to_s16__scalar(pOut + i, pIn + i*3, sampleCount - i);
+}
+#endif
+
+DRWAV_API void drwav_s24_to_s16(drwav_int16* pOut, const drwav_uint8* pIn, size_t sampleCount)
+{
+    drwav__init_cpu_caps();
+
+#if defined(DRWAV_SUPPORT_AVX2)
+    if (drwav__gIsAVX2Supported) {
+        drwav_s24_to_s16__avx2(pOut, pIn, sampleCount);
+        return;
+    }
+#endif
+
+#if defined(DRWAV_SUPPORT_SSE2)
+    if (drwav__gIsSSE2Supported) {
+        drwav_s24_to_s16__sse2(pOut, pIn, sampleCount);
+        return;
+    }
+#endif
+
+#if defined(DRWAV_SUPPORT_NEON)
+    if (drwav__gIsNEONSupported) {
+        drwav_s24_to_s16__neon(pOut, pIn, sampleCount);
+        return;
+    }
+#endif
+
+    drwav_s24_to_s16__scalar(pOut, pIn, sampleCount);
+}
+
+DRWAV_PRIVATE void drwav_s32_to_s16__scalar(drwav_int16* pOut, const drwav_int32* pIn, size_t sampleCount)
 {
     int r;
     size_t i;
@@ -7188,7 +8060,80 @@ DRWAV_API void drwav_s32_to_s16(drwav_int16* pOut, const drwav_int32* pIn, size_
     }
 }
 
-DRWAV_API void drwav_f32_to_s16(drwav_int16* pOut, const float* pIn, size_t sampleCount)
+#if defined(DRWAV_SUPPORT_AVX2)
+DRWAV_PRIVATE void drwav_s32_to_s16__avx2(drwav_int16* pOut, const drwav_int32* pIn, size_t sampleCount)
+{
+    size_t i;
+
+    for (i = 0; i + 16 <= sampleCount; i += 16) {
+        __m256i a = _mm256_srai_epi32(_mm256_loadu_si256((const __m256i*)(pIn + i + 0)), 16);
+        __m256i b = _mm256_srai_epi32(_mm256_loadu_si256((const __m256i*)(pIn + i + 8)), 16);
+        _mm256_storeu_si256((__m256i*)(pOut + i), _mm256_permute4x64_epi64(_mm256_packs_epi32(a, b), 0xD8));
+    }
+
+    drwav_s32_to_s16__scalar(pOut + i, pIn + i, sampleCount - i);
+}
+#endif
+
+#if defined(DRWAV_SUPPORT_SSE2)
+DRWAV_PRIVATE void drwav_s32_to_s16__sse2(drwav_int16* pOut, const drwav_int32* pIn, size_t sampleCount)
+{
+    size_t i;
+
+    for (i = 0; i + 8 <= sampleCount; i += 8) {
+        __m128i a = _mm_srai_epi32(_mm_loadu_si128((const __m128i*)(pIn + i + 0)), 16);
+        __m128i b = _mm_srai_epi32(_mm_loadu_si128((const __m128i*)(pIn + i + 4)), 16);
+        _mm_storeu_si128((__m128i*)(pOut + i), _mm_packs_epi32(a, b));
+    }
+
+    drwav_s32_to_s16__scalar(pOut + i, pIn + i, sampleCount - i);
+}
+#endif
+
+#if defined(DRWAV_SUPPORT_NEON)
+DRWAV_PRIVATE void drwav_s32_to_s16__neon(drwav_int16* pOut, const drwav_int32* pIn, size_t sampleCount)
+{
+    size_t i;
+
+    for (i = 0; i + 8 <= sampleCount; i += 8) {
+        int16x4_t a = vshrn_n_s32(vld1q_s32(pIn + i + 0), 16);
+        int16x4_t b = vshrn_n_s32(vld1q_s32(pIn + i + 4), 16);
+        vst1q_s16(pOut + i, vcombine_s16(a, b));
+    }
+
+    drwav_s32_to_s16__scalar(pOut + i, pIn + i, sampleCount - i);
+}
+#endif
+
+DRWAV_API void drwav_s32_to_s16(drwav_int16* pOut, const drwav_int32* pIn, size_t sampleCount)
+{
+    drwav__init_cpu_caps();
+
+#if defined(DRWAV_SUPPORT_AVX2)
+    if (drwav__gIsAVX2Supported) {
+        drwav_s32_to_s16__avx2(pOut, pIn, sampleCount);
+        return;
+    }
+#endif
+
+#if defined(DRWAV_SUPPORT_SSE2)
+    if (drwav__gIsSSE2Supported) {
+        drwav_s32_to_s16__sse2(pOut, pIn, sampleCount);
+        return;
+    }
+#endif
+
+#if defined(DRWAV_SUPPORT_NEON)
+    if (drwav__gIsNEONSupported) {
+        drwav_s32_to_s16__neon(pOut, pIn, sampleCount);
+        return;
+    }
+#endif
+
+    drwav_s32_to_s16__scalar(pOut, pIn, sampleCount);
+}
+
+DRWAV_PRIVATE void drwav_f32_to_s16__scalar(drwav_int16* pOut, const float* pIn, size_t sampleCount)
 {
     int r;
     size_t i;
@@ -7203,6 +8148,97 @@ DRWAV_API void drwav_f32_to_s16(drwav_int16* pOut, const float* pIn, size_t samp
     }
 }
 
+#if defined(DRWAV_SUPPORT_AVX2)
+DRWAV_PRIVATE void drwav_f32_to_s16__avx2(drwav_int16* pOut, const float* pIn, size_t sampleCount)
+{
+    size_t i;
+    const __m256  minusOne = _mm256_set1_ps(-1.0f);
+    const __m256  plusOne  = _mm256_set1_ps( 1.0f);
+    const __m256  scale    = _mm256_set1_ps(32767.5f);
+    const __m256i offset   = _mm256_set1_epi32(32768);
+
+    /* This needs to match the scalar implementation exactly: clamp, shift to 0..2, scale, truncate, then shift back. */
+    for (i = 0; i + 8 <= sampleCount; i += 8) {
+        __m256  c = _mm256_min_ps(_mm256_max_ps(_mm256_loadu_ps(pIn + i), minusOne), plusOne);
+        __m256i r = _mm256_sub_epi32(_mm256_cvttps_epi32(_mm256_mul_ps(_mm256_add_ps(c, plusOne), scale)), offset);
+        _mm_storeu_si128((__m128i*)(pOut + i), _mm_packs_epi32(_mm256_castsi256_si128(r), _mm256_extracti128_si256(r, 1)));
+    }
+
+    drwav_f32_to_s16__scalar(pOut + i, pIn + i, sampleCount - i);
+}
+#endif
+
+#if defined(DRWAV_SUPPORT_SSE2)
+DRWAV_PRIVATE void drwav_f32_to_s16__sse2(drwav_int16* pOut, const float* pIn, size_t sampleCount)
+{
+    size_t i;
+    const __m128  minusOne = _mm_set1_ps(-1.0f);
+    const __m128  plusOne  = _mm_set1_ps( 1.0f);
+    const __m128  scale    = _mm_set1_ps(32767.5f);
+    const __m128i offset   = _mm_set1_epi32(32768);
+
+    /* This needs to match the scalar implementation exactly: clamp, shift to 0..2, scale, truncate, then shift back. */
+    for (i = 0; i + 8 <= sampleCount; i += 8) {
+        __m128  c0 = _mm_min_ps(_mm_max_ps(_mm_loadu_ps(pIn + i + 0), minusOne), plusOne);
+        __m128  c1 = _mm_min_ps(_mm_max_ps(_mm_loadu_ps(pIn + i + 4), minusOne), plusOne);
+        __m128i r0 = _mm_sub_epi32(_mm_cvttps_epi32(_mm_mul_ps(_mm_add_ps(c0, plusOne), scale)), offset);
+        __m128i r1 = _mm_sub_epi32(_mm_cvttps_epi32(_mm_mul_ps(_mm_add_ps(c1, plusOne), scale)), offset);
+        _mm_storeu_si128((__m128i*)(pOut + i), _mm_packs_epi32(r0, r1));
+    }
+
+    drwav_f32_to_s16__scalar(pOut + i, pIn + i, sampleCount - i);
+}
+#endif
+
+#if defined(DRWAV_SUPPORT_NEON)
+DRWAV_PRIVATE void drwav_f32_to_s16__neon(drwav_int16* pOut, const float* pIn, size_t sampleCount)
+{
+    size_t i;
+    const float32x4_t minusOne = vdupq_n_f32(-1.0f);
+    const float32x4_t plusOne  = vdupq_n_f32( 1.0f);
+    const int32x4_t   offset   = vdupq_n_s32(32768);
+
+    /* This needs to match the scalar implementation exactly: clamp, shift to 0..2, scale, truncate, then shift back. */
+    for (i = 0; i + 8 <= sampleCount; i += 8) {
+        float32x4_t c0 = vminq_f32(vmaxq_f32(vld1q_f32(pIn + i + 0), minusOne), plusOne);
+        float32x4_t c1 = vminq_f32(vmaxq_f32(vld1q_f32(pIn + i + 4), minusOne), plusOne);
+        int32x4_t   r0 = vsubq_s32(vcvtq_s32_f32(vmulq_n_f32(vaddq_f32(c0, plusOne), 32767.5f)), offset);
+        int32x4_t   r1 = vsubq_s32(vcvtq_s32_f32(vmulq_n_f32(vaddq_f32(c1, plusOne), 32767.5f)), offset);
+        vst1q_s16(pOut + i, vcombine_s16(vqmovn_s32(r0), vqmovn_s32(r1)));
+    }
+
+    drwav_f32_to_s16__scalar(pOut + i, pIn + i, sampleCount - i);
+}
+#endif
+
+DRWAV_API void drwav_f32_to_s16(drwav_int16* pOut, const float* pIn, size_t sampleCount)
+{
+    drwav__init_cpu_caps();
+
+#if defined(DRWAV_SUPPORT_AVX2)
+    if (drwav__gIsAVX2Supported) {
+        drwav_f32_to_s16__avx2(pOut, pIn, sampleCount);
+        return;
+    }
+#endif
+
+#if defined(DRWAV_SUPPORT_SSE2)
+    if (drwav__gIsSSE2Supported) {
+        drwav_f32_to_s16__sse2(pOut, pIn, sampleCount);
+        return;
+    }
+#endif
+
+#if defined(DRWAV_SUPPORT_NEON)
+    if (drwav__gIsNEONSupported) {
+        drwav_f32_to_s16__neon(pOut, pIn, sampleCount);
+        return;
+    }
+#endif
+
+    drwav_f32_to_s16__scalar(pOut, pIn, sampleCount);
+}
+
 DRWAV_API void drwav_f64_to_s16(drwav_int16* pOut, const double* pIn, size_t sampleCount)
 {
     int r;
@@ -7291,10 +8327,7 @@ DRWAV_PRIVATE void drwav__pcm_to_f32(float* pOut, const drwav_uint8* pIn, size_t
 DRWAV_PRIVATE void drwav__ieee_to_f32(float* pOut, const drwav_uint8* pIn, size_t sampleCount, unsigned int bytesPerSample)
 {
     if (bytesPerSample == 4) {
-        unsigned int i;
-        for (i = 0; i < sampleCount; ++i) {
-            *pOut++ = ((const float*)pIn)[i];
-        }
+        DRWAV_COPY_MEMORY(pOut, pIn, sampleCount * sizeof(*pOut));
         return;
     } else if (bytesPerSample == 8) {
         drwav_f64_to_f32(pOut, (const double*)pIn, sampleCount);
@@ -7329,7 +8362,8 @@ DRWAV_PRIVATE drwav_uint64 drwav_read_pcm_frames_f32__pcm(drwav* pWav, drwav_uin
 
     while (framesToRead > 0) {
         drwav_uint64 framesToReadThisIteration = drwav_min(framesToRead, sizeof(sampleData)/bytesPerFrame);
-        drwav_uint64 framesRead = drwav_read_pcm_frames(pWav, framesToReadThisIteration, sampleData);
+        const drwav_uint8* pSampleData;
+        drwav_uint64 framesRead = drwav__read_or_map_pcm_frames(pWav, framesToReadThisIteration, sampleData, &pSampleData);
         if (framesRead == 0) {
             break;
         }
@@ -7343,7 +8377,7 @@ DRWAV_PRIVATE drwav_uint64 drwav_read_pcm_frames_f32__pcm(drwav* pWav, drwav_uin
             break;
         }
 
-        drwav__pcm_to_f32(pBufferOut, sampleData, (size_t)samplesRead, bytesPerSample);
+        drwav__pcm_to_f32(pBufferOut, pSampleData, (size_t)samplesRead, bytesPerSample);
 
         pBufferOut      += samplesRead;
         framesToRead    -= framesRead;
@@ -7410,7 +8444,8 @@ DRWAV_PRIVATE drwav_uint64 drwav_read_pcm_frames_f32__ieee(drwav* pWav, drwav_ui
 
     while (framesToRead > 0) {
         drwav_uint64 framesToReadThisIteration = drwav_min(framesToRead, sizeof(sampleData)/bytesPerFrame);
-        drwav_uint64 framesRead = drwav_read_pcm_frames(pWav, framesToReadThisIteration, sampleData);
+        const drwav_uint8* pSampleData;
+        drwav_uint64 framesRead = drwav__read_or_map_pcm_frames(pWav, framesToReadThisIteration, sampleData, &pSampleData);
         if (framesRead == 0) {
             break;
         }
@@ -7424,7 +8459,7 @@ DRWAV_PRIVATE drwav_uint64 drwav_read_pcm_frames_f32__ieee(drwav* pWav, drwav_ui
             break;
         }
 
-        drwav__ieee_to_f32(pBufferOut, sampleData, (size_t)samplesRead, bytesPerSample);
+        drwav__ieee_to_f32(pBufferOut, pSampleData, (size_t)samplesRead, bytesPerSample);
 
         pBufferOut      += samplesRead;
         framesToRead    -= framesRead;
@@ -7456,7 +8491,8 @@ DRWAV_PRIVATE drwav_uint64 drwav_read_pcm_frames_f32__alaw(drwav* pWav, drwav_ui
 
     while (framesToRead > 0) {
         drwav_uint64 framesToReadThisIteration = drwav_min(framesToRead, sizeof(sampleData)/bytesPerFrame);
-        drwav_uint64 framesRead = drwav_read_pcm_frames(pWav, framesToReadThisIteration, sampleData);
+        const drwav_uint8* pSampleData;
+        drwav_uint64 framesRead = drwav__read_or_map_pcm_frames(pWav, framesToReadThisIteration, sampleData, &pSampleData);
         if (framesRead == 0) {
             break;
         }
@@ -7470,7 +8506,7 @@ DRWAV_PRIVATE drwav_uint64 drwav_read_pcm_frames_f32__alaw(drwav* pWav, drwav_ui
             break;
         }
 
-        drwav_alaw_to_f32(pBufferOut, sampleData, (size_t)samplesRead);
+        drwav_alaw_to_f32(pBufferOut, pSampleData, (size_t)samplesRead);
 
         #ifdef DR_WAV_LIBSNDFILE_COMPAT
         {
@@ -7513,7 +8549,8 @@ DRWAV_PRIVATE drwav_uint64 drwav_read_pcm_frames_f32__mulaw(drwav* pWav, drwav_u
 
     while (framesToRead > 0) {
         drwav_uint64 framesToReadThisIteration = drwav_min(framesToRead, sizeof(sampleData)/bytesPerFrame);
-        drwav_uint64 framesRead = drwav_read_pcm_frames(pWav, framesToReadThisIteration, sampleData);
+        const drwav_uint8* pSampleData;
+        drwav_uint64 framesRead = drwav__read_or_map_pcm_frames(pWav, framesToReadThisIteration, sampleData, &pSampleData);
         if (framesRead == 0) {
             break;
         }
@@ -7527,7 +8564,7 @@ DRWAV_PRIVATE drwav_uint64 drwav_read_pcm_frames_f32__mulaw(drwav* pWav, drwav_u
             break;
         }
 
-        drwav_mulaw_to_f32(pBufferOut, sampleData, (size_t)samplesRead);
+        drwav_mulaw_to_f32(pBufferOut, pSampleData, (size_t)samplesRead);
 
         #ifdef DR_WAV_LIBSNDFILE_COMPAT
         {
@@ -7579,105 +8616,335 @@ DRWAV_API drwav_uint64 drwav_read_pcm_frames_f32(drwav* pWav, drwav_uint64 frame
         return drwav_read_pcm_frames_f32__alaw(pWav, framesToRead, pBufferOut);
     }
 
-    if (pWav->translatedFormatTag == DR_WAVE_FORMAT_MULAW) {
-        return drwav_read_pcm_frames_f32__mulaw(pWav, framesToRead, pBufferOut);
+    if (pWav->translatedFormatTag == DR_WAVE_FORMAT_MULAW) {
+        return drwav_read_pcm_frames_f32__mulaw(pWav, framesToRead, pBufferOut);
+    }
+
+    return 0;
+}
+
+DRWAV_API drwav_uint64 drwav_read_pcm_frames_f32le(drwav* pWav, drwav_uint64 framesToRead, float* pBufferOut)
+{
+    drwav_uint64 framesRead = drwav_read_pcm_frames_f32(pWav, framesToRead, pBufferOut);
+    if (pBufferOut != NULL && drwav__is_little_endian() == DRWAV_FALSE) {
+        drwav__bswap_samples_f32(pBufferOut, framesRead*pWav->channels);
+    }
+
+    return framesRead;
+}
+
+DRWAV_API drwav_uint64 drwav_read_pcm_frames_f32be(drwav* pWav, drwav_uint64 framesToRead, float* pBufferOut)
+{
+    drwav_uint64 framesRead = drwav_read_pcm_frames_f32(pWav, framesToRead, pBufferOut);
+    if (pBufferOut != NULL && drwav__is_little_endian() == DRWAV_TRUE) {
+        drwav__bswap_samples_f32(pBufferOut, framesRead*pWav->channels);
+    }
+
+    return framesRead;
+}
+
+
+DRWAV_API void drwav_u8_to_f32(float* pOut, const drwav_uint8* pIn, size_t sampleCount)
+{
+    size_t i;
+
+    if (pOut == NULL || pIn == NULL) {
+        return;
+    }
+
+#ifdef DR_WAV_LIBSNDFILE_COMPAT
+    /*
+    It appears libsndfile uses slightly different logic for the u8 -> f32 conversion to dr_wav, which in my opinion is incorrect. It appears
+    libsndfile performs the conversion something like "f32 = (u8 / 256) * 2 - 1", however I think it should be "f32 = (u8 / 255) * 2 - 1" (note
+    the divisor of 256 vs 255). I use libsndfile as a benchmark for testing, so I'm therefore leaving this block here just for my automated
+    correctness testing. This is disabled by default.
+    */
+    for (i = 0; i < sampleCount; ++i) {
+        *pOut++ = (pIn[i] / 256.0f) * 2 - 1;
+    }
+#else
+    for (i = 0; i < sampleCount; ++i) {
+        float x = pIn[i];
+        x = x * 0.00784313725490196078f;    /* 0..255 to 0..2 */
+        x = x - 1;                          /* 0..2 to -1..1 */
+
+        *pOut++ = x;
+    }
+#endif
+}
+
+DRWAV_PRIVATE void drwav_s16_to_f32__scalar(float* pOut, const drwav_int16* pIn, size_t sampleCount)
+{
+    size_t i;
+
+    for (i = 0; i < sampleCount; ++i) {
+        *pOut++ = pIn[i] * 0.000030517578125f;
+    }
+}
+
+#if defined(DRWAV_SUPPORT_AVX2)
+DRWAV_PRIVATE void drwav_s16_to_f32__avx2(float* pOut, const drwav_int16* pIn, size_t sampleCount)
+{
+    size_t i;
+    const __m256 scale = _mm256_set1_ps(0.000030517578125f);
+
+    for (i = 0; i + 16 <= sampleCount; i += 16) {
+        __m256i a = _mm256_cvtepi16_epi32(_mm_loadu_si128((const __m128i*)(pIn + i + 0)));
+        __m256i b = _mm256_cvtepi16_epi32(_mm_loadu_si128((const __m128i*)(pIn + i + 8)));
+        _mm256_storeu_ps(pOut + i + 0, _mm256_mul_ps(_mm256_cvtepi32_ps(a), scale));
+        _mm256_storeu_ps(pOut + i + 8, _mm256_mul_ps(_mm256_cvtepi32_ps(b), scale));
+    }
+
+    drwav_s16_to_f32__scalar(pOut + i, pIn + i, sampleCount - i);
+}
+#endif
+
+#if defined(DRWAV_SUPPORT_SSE2)
+DRWAV_PRIVATE void drwav_s16_to_f32__sse2(float* pOut, const drwav_int16* pIn, size_t sampleCount)
+{
+    size_t i;
+    const __m128 scale = _mm_set1_ps(0.000030517578125f);
+
+    for (i = 0; i + 8 <= sampleCount; i += 8) {
+        __m128i x = _mm_loadu_si128((const __m128i*)(pIn + i));
+        __m128i a = _mm_srai_epi32(_mm_unpacklo_epi16(x, x), 16);
+        __m128i b = _mm_srai_epi32(_mm_unpackhi_epi16(x, x), 16);
+        _mm_storeu_ps(pOut + i + 0, _mm_mul_ps(_mm_cvtepi32_ps(a), scale));
+        _mm_storeu_ps(pOut + i + 4, _mm_mul_ps(_mm_cvtepi32_ps(b), scale));
+    }
+
+    drwav_s16_to_f32__scalar(pOut + i, pIn + i, sampleCount - i);
+}
+#endif
+
+#if defined(DRWAV_SUPPORT_NEON)
+DRWAV_PRIVATE void drwav_s16_to_f32__neon(float* pOut, const drwav_int16* pIn, size_t sampleCount)
+{
+    size_t i;
+
+    for (i = 0; i + 8 <= sampleCount; i += 8) {
+        int16x8_t x = vld1q_s16(pIn + i);
+        vst1q_f32(pOut + i + 0, vmulq_n_f32(vcvtq_f32_s32(vmovl_s16(vget_low_s16 (x))), 0.000030517578125f));
+        vst1q_f32(pOut + i + 4, vmulq_n_f32(vcvtq_f32_s32(vmovl_s16(vget_high_s16(x))), 0.000030517578125f));
+    }
+
+    drwav_s16_to_f32__scalar(pOut + i, pIn + i, sampleCount - i);
+}
+#endif
+
+DRWAV_API void drwav_s16_to_f32(float* pOut, const drwav_int16* pIn, size_t sampleCount)
+{
+    if (pOut == NULL || pIn == NULL) {
+        return;
+    }
+
+    drwav__init_cpu_caps();
+
+#if defined(DRWAV_SUPPORT_AVX2)
+    if (drwav__gIsAVX2Supported) {
+        drwav_s16_to_f32__avx2(pOut, pIn, sampleCount);
+        return;
+    }
+#endif
+
+#if defined(DRWAV_SUPPORT_SSE2)
+    if (drwav__gIsSSE2Supported) {
+        drwav_s16_to_f32__sse2(pOut, pIn, sampleCount);
+        return;
+    }
+#endif
+
+#if defined(DRWAV_SUPPORT_NEON)
+    if (drwav__gIsNEONSupported) {
+        drwav_s16_to_f32__neon(pOut, pIn, sampleCount);
+        return;
+    }
+#endif
+
+    drwav_s16_to_f32__scalar(pOut, pIn, sampleCount);
+}
+
+DRWAV_PRIVATE void drwav_s24_to_f32__scalar(float* pOut, const drwav_uint8* pIn, size_t sampleCount)
+{
+    size_t i;
+
+    for (i = 0; i < sampleCount; ++i) {
+        double x;
+        drwav_uint32 a = ((drwav_uint32)(pIn[i*3+0]) <<  8);
+        drwav_uint32 b = ((drwav_uint32)(pIn[i*3+1]) << 16);
+        drwav_uint32 c = ((drwav_uint32)(pIn[i*3+2]) << 24);
+
+        x = (double)((drwav_int32)(a | b | c) >> 8);
+        *pOut++ = (float)(x * 0.00000011920928955078125);
+    }
+}
+
+#if defined(DRWAV_SUPPORT_AVX2)
+DRWAV_PRIVATE void drwav_s24_to_f32__avx2(float* pOut, const drwav_uint8* pIn, size_t sampleCount)
+{
+    size_t i;
+    const __m256 scale = _mm256_set1_ps(0.00000011920928955078125f);
+
+    /* The scalar path goes through double, but the result is exact in single precision so this is bit-identical. */
+    for (i = 0; i + 10 <= sampleCount; i += 8) {
+        __m256i x = _mm256_srai_epi32(drwav__mm256_unpack_s24(pIn + i*3), 8);
+        _mm256_storeu_ps(pOut + i, _mm256_mul_ps(_mm256_cvtepi32_ps(x), scale));
+    }
+
+    drwav_s24_to_f32__scalar(pOut + i, pIn + i*3, sampleCount - i);
+}
+#endif
+
+#if defined(DRWAV_SUPPORT_SSE2)
+DRWAV_PRIVATE void drwav_s24_to_f32__sse2(float* pOut, const drwav_uint8* pIn, size_t sampleCount)
+{
+    size_t i;
+    const __m128 scale = _mm_set1_ps(0.00000011920928955078125f);
+
+    /* The scalar path goes through double, but the result is exact in single precision so this is bit-identical. */
+    for (i = 0; i + 10 <= sampleCount; i += 8) {
+        __m128i a = _mm_srai_epi32(drwav__mm_unpack_s24(_mm_loadu_si128((const __m128i*)(pIn + i*3 +  0))), 8);
+        __m128i b = _mm_srai_epi32(drwav__mm_unpack_s24(_mm_loadu_si128((const __m128i*)(pIn + i*3 + 12))), 8);
+        _mm_storeu_ps(pOut + i + 0, _mm_mul_ps(_mm_cvtepi32_ps(a), scale));
+        _mm_storeu_ps(pOut + i + 4, _mm_mul_ps(_mm_cvtepi32_ps(b), scale));
+    }
+
+    drwav_s24_to_f32__scalar(pOut + i, pIn + i*3, sampleCount - i);
+}
+#endif
+
+#if defined(DRWAV_SUPPORT_NEON)
+DRWAV_PRIVATE void drwav_s24_to_f32__neon(float* pOut, const drwav_uint8* pIn, size_t sampleCount)
+{
+    size_t i;
+    uint32x4_t lo;
+    uint32x4_t hi;
+
+    /* The scalar path goes through double, but the result is exact in single precision so this is bit-identical. */
+    for (i = 0; i + 8 <= sampleCount; i += 8) {
+        drwav__neon_unpack_s24(pIn + i*3, &lo, &hi);
+        vst1q_f32(pOut + i + 0, vmulq_n_f32(vcvtq_f32_s32(vshrq_n_s32(vreinterpretq_s32_u32(lo), 8)), 0.00000011920928955078125f));
+        vst1q_f32(pOut + i + 4, vmulq_n_f32(vcvtq_f32_s32(vshrq_n_s32(vreinterpretq_s32_u32(hi), 8)), 0.00000011920928955078125f));
+    }
+
+    drwav_s24_to_f32__scalar(pOut + i, pIn + i*3, sampleCount - i);
+}
+#endif
+
+DRWAV_API void drwav_s24_to_f32(float* pOut, const drwav_uint8* pIn, size_t sampleCount)
+{
+    if (pOut == NULL || pIn == NULL) {
+        return;
+    }
+
+    drwav__init_cpu_caps();
+
+#if defined(DRWAV_SUPPORT_AVX2)
+    if (drwav__gIsAVX2Supported) {
+        drwav_s24_to_f32__avx2(pOut, pIn, sampleCount);
+        return;
+    }
+#endif
+
+#if defined(DRWAV_SUPPORT_SSE2)
+    if (drwav__gIsSSE2Supported) {
+        drwav_s24_to_f32__sse2(pOut, pIn, sampleCount);
+        return;
+    }
+#endif
+
+#if defined(DRWAV_SUPPORT_NEON)
+    if (drwav__gIsNEONSupported) {
+        drwav_s24_to_f32__neon(pOut, pIn, sampleCount);
+        return;
     }
+#endif
 
-    return 0;
+    drwav_s24_to_f32__scalar(pOut, pIn, sampleCount);
 }
 
-DRWAV_API drwav_uint64 drwav_read_pcm_frames_f32le(drwav* pWav, drwav_uint64 framesToRead, float* pBufferOut)
+DRWAV_PRIVATE void drwav_s32_to_f32__scalar(float* pOut, const drwav_int32* pIn, size_t sampleCount)
 {
-    drwav_uint64 framesRead = drwav_read_pcm_frames_f32(pWav, framesToRead, pBufferOut);
-    if (pBufferOut != NULL && drwav__is_little_endian() == DRWAV_FALSE) {
-        drwav__bswap_samples_f32(pBufferOut, framesRead*pWav->channels);
+    size_t i;
+    for (i = 0; i < sampleCount; ++i) {
+        *pOut++ = (float)(pIn[i] / 2147483648.0);
     }
-
-    return framesRead;
 }
 
-DRWAV_API drwav_uint64 drwav_read_pcm_frames_f32be(drwav* pWav, drwav_uint64 framesToRead, float* pBufferOut)
+#if defined(DRWAV_SUPPORT_AVX2)
+DRWAV_PRIVATE void drwav_s32_to_f32__avx2(float* pOut, const drwav_int32* pIn, size_t sampleCount)
 {
-    drwav_uint64 framesRead = drwav_read_pcm_frames_f32(pWav, framesToRead, pBufferOut);
-    if (pBufferOut != NULL && drwav__is_little_endian() == DRWAV_TRUE) {
-        drwav__bswap_samples_f32(pBufferOut, framesRead*pWav->channels);
+    size_t i;
+    const __m256 scale = _mm256_set1_ps(0.0000000004656612873077392578125f);
+
+    /* Rounding to single precision before scaling by a power of two gives the same result as the scalar path. */
+    for (i = 0; i + 8 <= sampleCount; i += 8) {
+        _mm256_storeu_ps(pOut + i, _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_loadu_si256((const __m256i*)(pIn + i))), scale));
     }
 
-    return framesRead;
+    drwav_s32_to_f32__scalar(pOut + i, pIn + i, sampleCount - i);
 }
+#endif
 
-
-DRWAV_API void drwav_u8_to_f32(float* pOut, const drwav_uint8* pIn, size_t sampleCount)
+#if defined(DRWAV_SUPPORT_SSE2)
+DRWAV_PRIVATE void drwav_s32_to_f32__sse2(float* pOut, const drwav_int32* pIn, size_t sampleCount)
 {
     size_t i;
+    const __m128 scale = _mm_set1_ps(0.0000000004656612873077392578125f);
 
-    if (pOut == NULL || pIn == NULL) {
-        return;
-    }
-
-#ifdef DR_WAV_LIBSNDFILE_COMPAT
-    /*
-    It appears libsndfile uses slightly different logic for the u8 -> f32 conversion to dr_wav, which in my opinion is incorrect. It appears
-    libsndfile performs the conversion something like "f32 = (u8 / 256) * 2 - 1", however I think it should be "f32 = (u8 / 255) * 2 - 1" (note
-    the divisor of 256 vs 255). I use libsndfile as a benchmark for testing, so I'm therefore leaving this block here just for my automated
-    correctness testing. This is disabled by default.
-    */
-    for (i = 0; i < sampleCount; ++i) {
-        *pOut++ = (pIn[i] / 256.0f) * 2 - 1;
+    /* Rounding to single precision before scaling by a power of two gives the same result as the scalar path. */
+    for (i = 0; i + 4 <= sampleCount; i += 4) {
+        _mm_storeu_ps(pOut + i, _mm_mul_ps(_mm_cvtepi32_ps(_mm_loadu_si128((const __m128i*)(pIn + i))), scale));
     }
-#else
-    for (i = 0; i < sampleCount; ++i) {
-        float x = pIn[i];
-        x = x * 0.00784313725490196078f;    /* 0..255 to 0..2 */
-        x = x - 1;                          /* 0..2 to -1..1 */
 
-        *pOut++ = x;
-    }
-#endif
+    drwav_s32_to_f32__scalar(pOut + i, pIn + i, sampleCount - i);
 }
+#endif
 
-DRWAV_API void drwav_s16_to_f32(float* pOut, const drwav_int16* pIn, size_t sampleCount)
+#if defined(DRWAV_SUPPORT_NEON)
+DRWAV_PRIVATE void drwav_s32_to_f32__neon(float* pOut, const drwav_int32* pIn, size_t sampleCount)
 {
     size_t i;
 
-    if (pOut == NULL || pIn == NULL) {
-        return;
+    /* Rounding to single precision before scaling by a power of two gives the same result as the scalar path. */
+    for (i = 0; i + 4 <= sampleCount; i += 4) {
+        vst1q_f32(pOut + i, vmulq_n_f32(vcvtq_f32_s32(vld1q_s32(pIn + i)), 0.0000000004656612873077392578125f));
     }
 
-    for (i = 0; i < sampleCount; ++i) {
-        *pOut++ = pIn[i] * 0.000030517578125f;
-    }
+    drwav_s32_to_f32__scalar(pOut + i, pIn + i, sampleCount - i);
 }
+#endif
 
-DRWAV_API void drwav_s24_to_f32(float* pOut, const drwav_uint8* pIn, size_t sampleCount)
+DRWAV_API void drwav_s32_to_f32(float* pOut, const drwav_int32* pIn, size_t sampleCount)
 {
-    size_t i;
-
     if (pOut == NULL || pIn == NULL) {
         return;
     }
 
-    for (i = 0; i < sampleCount; ++i) {
-        double x;
-        drwav_uint32 a = ((drwav_uint32)(pIn[i*3+0]) <<  8);
-        drwav_uint32 b = ((drwav_uint32)(pIn[i*3+1]) << 16);
-        drwav_uint32 c = ((drwav_uint32)(pIn[i*3+2]) << 24);
+    drwav__init_cpu_caps();
 
-        x = (double)((drwav_int32)(a | b | c) >> 8);
-        *pOut++ = (float)(x * 0.00000011920928955078125);
+#if defined(DRWAV_SUPPORT_AVX2)
+    if (drwav__gIsAVX2Supported) {
+        drwav_s32_to_f32__avx2(pOut, pIn, sampleCount);
+        return;
     }
-}
+#endif
 
-DRWAV_API void drwav_s32_to_f32(float* pOut, const drwav_int32* pIn, size_t sampleCount)
-{
-    size_t i;
-    if (pOut == NULL || pIn == NULL) {
+#if defined(DRWAV_SUPPORT_SSE2)
+    if (drwav__gIsSSE2Supported) {
+        drwav_s32_to_f32__sse2(pOut, pIn, sampleCount);
         return;
     }
+#endif
 
-    for (i = 0; i < sampleCount; ++i) {
-        *pOut++ = (float)(pIn[i] / 2147483648.0);
+#if defined(DRWAV_SUPPORT_NEON)
+    if (drwav__gIsNEONSupported) {
+        drwav_s32_to_f32__neon(pOut, pIn, sampleCount);
+        return;
     }
+#endif
+
+    drwav_s32_to_f32__scalar(pOut, pIn, sampleCount);
 }
 
 DRWAV_API void drwav_f64_to_f32(float* pOut, const double* pIn, size_t sampleCount)
@@ -7741,9 +9008,7 @@ DRWAV_PRIVATE void drwav__pcm_to_s32(drwav_int32* pOut, const drwav_uint8* pIn,
         return;
     }
     if (bytesPerSample == 4) {
-        for (i = 0; i < totalSampleCount; ++i) {
-           *pOut++ = ((const drwav_int32*)pIn)[i];
-        }
+        DRWAV_COPY_MEMORY(pOut, pIn, totalSampleCount * sizeof(*pOut));
         return;
     }
 
@@ -7819,7 +9084,8 @@ DRWAV_PRIVATE drwav_uint64 drwav_read_pcm_frames_s32__pcm(drwav* pWav, drwav_uin
 
     while (framesToRead > 0) {
         drwav_uint64 framesToReadThisIteration = drwav_min(framesToRead, sizeof(sampleData)/bytesPerFrame);
-        drwav_uint64 framesRead = drwav_read_pcm_frames(pWav, framesToReadThisIteration, sampleData);
+        const drwav_uint8* pSampleData;
+        drwav_uint64 framesRead = drwav__read_or_map_pcm_frames(pWav, framesToReadThisIteration, sampleData, &pSampleData);
         if (framesRead == 0) {
             break;
         }
@@ -7833,7 +9099,7 @@ DRWAV_PRIVATE drwav_uint64 drwav_read_pcm_frames_s32__pcm(drwav* pWav, drwav_uin
             break;
         }
 
-        drwav__pcm_to_s32(pBufferOut, sampleData, (size_t)samplesRead, bytesPerSample);
+        drwav__pcm_to_s32(pBufferOut, pSampleData, (size_t)samplesRead, bytesPerSample);
 
         pBufferOut      += samplesRead;
         framesToRead    -= framesRead;
@@ -7893,7 +9159,8 @@ DRWAV_PRIVATE drwav_uint64 drwav_read_pcm_frames_s32__ieee(drwav* pWav, drwav_ui
 
     while (framesToRead > 0) {
         drwav_uint64 framesToReadThisIteration = drwav_min(framesToRead, sizeof(sampleData)/bytesPerFrame);
-        drwav_uint64 framesRead = drwav_read_pcm_frames(pWav, framesToReadThisIteration, sampleData);
+        const drwav_uint8* pSampleData;
+        drwav_uint64 framesRead = drwav__read_or_map_pcm_frames(pWav, framesToReadThisIteration, sampleData, &pSampleData);
         if (framesRead == 0) {
             break;
         }
@@ -7907,7 +9174,7 @@ DRWAV_PRIVATE drwav_uint64 drwav_read_pcm_frames_s32__ieee(drwav* pWav, drwav_ui
             break;
         }
 
-        drwav__ieee_to_s32(pBufferOut, sampleData, (size_t)samplesRead, bytesPerSample);
+        drwav__ieee_to_s32(pBufferOut, pSampleData, (size_t)samplesRead, bytesPerSample);
 
         pBufferOut      += samplesRead;
         framesToRead    -= framesRead;
@@ -7939,7 +9206,8 @@ DRWAV_PRIVATE drwav_uint64 drwav_read_pcm_frames_s32__alaw(drwav* pWav, drwav_ui
 
     while (framesToRead > 0) {
         drwav_uint64 framesToReadThisIteration = drwav_min(framesToRead, sizeof(sampleData)/bytesPerFrame);
-        drwav_uint64 framesRead = drwav_read_pcm_frames(pWav, framesToReadThisIteration, sampleData);
+        const drwav_uint8* pSampleData;
+        drwav_uint64 framesRead = drwav__read_or_map_pcm_frames(pWav, framesToReadThisIteration, sampleData, &pSampleData);
         if (framesRead == 0) {
             break;
         }
@@ -7953,7 +9221,7 @@ DRWAV_PRIVATE drwav_uint64 drwav_read_pcm_frames_s32__alaw(drwav* pWav, drwav_ui
             break;
         }
 
-        drwav_alaw_to_s32(pBufferOut, sampleData, (size_t)samplesRead);
+        drwav_alaw_to_s32(pBufferOut, pSampleData, (size_t)samplesRead);
 
         #ifdef DR_WAV_LIBSNDFILE_COMPAT
         {
@@ -7996,7 +9264,8 @@ DRWAV_PRIVATE drwav_uint64 drwav_read_pcm_frames_s32__mulaw(drwav* pWav, drwav_u
 
     while (framesToRead > 0) {
         drwav_uint64 framesToReadThisIteration = drwav_min(framesToRead, sizeof(sampleData)/bytesPerFrame);
-        drwav_uint64 framesRead = drwav_read_pcm_frames(pWav, framesToReadThisIteration, sampleData);
+        const drwav_uint8* pSampleData;
+        drwav_uint64 framesRead = drwav__read_or_map_pcm_frames(pWav, framesToReadThisIteration, sampleData, &pSampleData);
         if (framesRead == 0) {
             break;
         }
@@ -8010,7 +9279,7 @@ DRWAV_PRIVATE drwav_uint64 drwav_read_pcm_frames_s32__mulaw(drwav* pWav, drwav_u
             break;
         }
 
-        drwav_mulaw_to_s32(pBufferOut, sampleData, (size_t)samplesRead);
+        drwav_mulaw_to_s32(pBufferOut, pSampleData, (size_t)samplesRead);
 
         #ifdef DR_WAV_LIBSNDFILE_COMPAT
         {
@@ -8090,40 +9359,190 @@ DRWAV_API drwav_uint64 drwav_read_pcm_frames_s32be(drwav* pWav, drwav_uint64 fra
 }
 
 
-DRWAV_API void drwav_u8_to_s32(drwav_int32* pOut, const drwav_uint8* pIn, size_t sampleCount)
+DRWAV_PRIVATE void drwav_u8_to_s32__scalar(drwav_int32* pOut, const drwav_uint8* pIn, size_t sampleCount)
 {
     size_t i;
 
-    if (pOut == NULL || pIn == NULL) {
-        return;
-    }
-
     for (i = 0; i < sampleCount; ++i) {
         *pOut++ = ((int)pIn[i] - 128) * 16777216;
     }
 }
 
-DRWAV_API void drwav_s16_to_s32(drwav_int32* pOut, const drwav_int16* pIn, size_t sampleCount)
+#if defined(DRWAV_SUPPORT_AVX2)
+DRWAV_PRIVATE void drwav_u8_to_s32__avx2(drwav_int32* pOut, const drwav_uint8* pIn, size_t sampleCount)
+{
+    size_t i;
+    const __m256i bias = _mm256_set1_epi32(128);
+
+    for (i = 0; i + 8 <= sampleCount; i += 8) {
+        __m256i x = _mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i*)(pIn + i)));
+        _mm256_storeu_si256((__m256i*)(pOut + i), _mm256_slli_epi32(_mm256_sub_epi32(x, bias), 24));
+    }
+
+    drwav_u8_to_s32__scalar(pOut + i, pIn + i, sampleCount - i);
+}
+#endif
+
+#if defined(DRWAV_SUPPORT_SSE2)
+DRWAV_PRIVATE void drwav_u8_to_s32__sse2(drwav_int32* pOut, const drwav_uint8* pIn, size_t sampleCount)
+{
+    size_t i;
+    const __m128i bias = _mm_set1_epi8((char)0x80);
+    const __m128i zero = _mm_setzero_si128();
+
+    /* (x - 128) << 24 is the same as placing (x ^ 0x80) in the upper byte of each 32-bit lane. */
+    for (i = 0; i + 16 <= sampleCount; i += 16) {
+        __m128i x  = _mm_xor_si128(_mm_loadu_si128((const __m128i*)(pIn + i)), bias);
+        __m128i lo = _mm_unpacklo_epi8(zero, x);
+        __m128i hi = _mm_unpackhi_epi8(zero, x);
+        _mm_storeu_si128((__m128i*)(pOut + i +  0), _mm_unpacklo_epi16(zero, lo));
+        _mm_storeu_si128((__m128i*)(pOut + i +  4), _mm_unpackhi_epi16(zero, lo));
+        _mm_storeu_si128((__m128i*)(pOut + i +  8), _mm_unpacklo_epi16(zero, hi));
+        _mm_storeu_si128((__m128i*)(pOut + i + 12), _mm_unpackhi_epi16(zero, hi));
+    }
+
+    drwav_u8_to_s32__scalar(pOut + i, pIn + i, sampleCount - i);
+}
+#endif
+
+#if defined(DRWAV_SUPPORT_NEON)
+DRWAV_PRIVATE void drwav_u8_to_s32__neon(drwav_int32* pOut, const drwav_uint8* pIn, size_t sampleCount)
 {
     size_t i;
+    const uint8x8_t bias = vdup_n_u8(0x80);
+
+    for (i = 0; i + 8 <= sampleCount; i += 8) {
+        uint16x8_t x = vshll_n_u8(veor_u8(vld1_u8(pIn + i), bias), 8);
+        vst1q_s32(pOut + i + 0, vreinterpretq_s32_u32(vshll_n_u16(vget_low_u16 (x), 16)));
+        vst1q_s32(pOut + i + 4, vreinterpretq_s32_u32(vshll_n_u16(vget_high_u16(x), 16)));
+    }
 
+    drwav_u8_to_s32__scalar(pOut + i, pIn + i, sampleCount - i);
+}
+#endif
+
+DRWAV_API void drwav_u8_to_s32(drwav_int32* pOut, const drwav_uint8* pIn, size_t sampleCount)
+{
     if (pOut == NULL || pIn == NULL) {
         return;
     }
 
+    drwav__init_cpu_caps();
+
+#if defined(DRWAV_SUPPORT_AVX2)
+    if (drwav__gIsAVX2Supported) {
+        drwav_u8_to_s32__avx2(pOut, pIn, sampleCount);
+        return;
+    }
+#endif
+
+#if defined(DRWAV_SUPPORT_SSE2)
+    if (drwav__gIsSSE2Supported) {
+        drwav_u8_to_s32__sse2(pOut, pIn, sampleCount);
+        return;
+    }
+#endif
+
+#if defined(DRWAV_SUPPORT_NEON)
+    if (drwav__gIsNEONSupported) {
+        drwav_u8_to_s32__neon(pOut, pIn, sampleCount);
+        return;
+    }
+#endif
+
+    drwav_u8_to_s32__scalar(pOut, pIn, sampleCount);
+}
+
+DRWAV_PRIVATE void drwav_s16_to_s32__scalar(drwav_int32* pOut, const drwav_int16* pIn, size_t sampleCount)
+{
+    size_t i;
+
     for (i = 0; i < sampleCount; ++i) {
         *pOut++ = (drwav_int32)pIn[i] * 65536;
     }
 }
 
-DRWAV_API void drwav_s24_to_s32(drwav_int32* pOut, const drwav_uint8* pIn, size_t sampleCount)
+#if defined(DRWAV_SUPPORT_AVX2)
+DRWAV_PRIVATE void drwav_s16_to_s32__avx2(drwav_int32* pOut, const drwav_int16* pIn, size_t sampleCount)
 {
     size_t i;
 
+    for (i = 0; i + 8 <= sampleCount; i += 8) {
+        __m256i x = _mm256_cvtepi16_epi32(_mm_loadu_si128((const __m128i*)(pIn + i)));
+        _mm256_storeu_si256((__m256i*)(pOut + i), _mm256_slli_epi32(x, 16));
+    }
+
+    drwav_s16_to_s32__scalar(pOut + i, pIn + i, sampleCount - i);
+}
+#endif
+
+#if defined(DRWAV_SUPPORT_SSE2)
+DRWAV_PRIVATE void drwav_s16_to_s32__sse2(drwav_int32* pOut, const drwav_int16* pIn, size_t sampleCount)
+{
+    size_t i;
+    const __m128i zero = _mm_setzero_si128();
+
+    for (i = 0; i + 8 <= sampleCount; i += 8) {
+        __m128i x = _mm_loadu_si128((const __m128i*)(pIn + i));
+        _mm_storeu_si128((__m128i*)(pOut + i + 0), _mm_unpacklo_epi16(zero, x));
+        _mm_storeu_si128((__m128i*)(pOut + i + 4), _mm_unpackhi_epi16(zero, x));
+    }
+
+    drwav_s16_to_s32__scalar(pOut + i, pIn + i, sampleCount - i);
+}
+#endif
+
+#if defined(DRWAV_SUPPORT_NEON)
+DRWAV_PRIVATE void drwav_s16_to_s32__neon(drwav_int32* pOut, const drwav_int16* pIn, size_t sampleCount)
+{
+    size_t i;
+
+    for (i = 0; i + 8 <= sampleCount; i += 8) {
+        int16x8_t x = vld1q_s16(pIn + i);
+        vst1q_s32(pOut + i + 0, vshll_n_s16(vget_low_s16 (x), 16));
+        vst1q_s32(pOut + i + 4, vshll_n_s16(vget_high_s16(x), 16));
+    }
+
+    drwav_s16_to_s32__scalar(pOut + i, pIn + i, sampleCount - i);
+}
+#endif
+
+DRWAV_API void drwav_s16_to_s32(drwav_int32* pOut, const drwav_int16* pIn, size_t sampleCount)
+{
     if (pOut == NULL || pIn == NULL) {
         return;
     }
 
+    drwav__init_cpu_caps();
+
+#if defined(DRWAV_SUPPORT_AVX2)
+    if (drwav__gIsAVX2Supported) {
+        drwav_s16_to_s32__avx2(pOut, pIn, sampleCount);
+        return;
+    }
+#endif
+
+#if defined(DRWAV_SUPPORT_SSE2)
+    if (drwav__gIsSSE2Supported) {
+        drwav_s16_to_s32__sse2(pOut, pIn, sampleCount);
+        return;
+    }
+#endif
+
+#if defined(DRWAV_SUPPORT_NEON)
+    if (drwav__gIsNEONSupported) {
+        drwav_s16_to_s32__neon(pOut, pIn, sampleCount);
+        return;
+    }
+#endif
+
+    drwav_s16_to_s32__scalar(pOut, pIn, sampleCount);
+}
+
+DRWAV_PRIVATE void drwav_s24_to_s32__scalar(drwav_int32* pOut, const drwav_uint8* pIn, size_t sampleCount)
+{
+    size_t i;
+
     for (i = 0; i < sampleCount; ++i) {
         unsigned int s0 = pIn[i*3 + 0];
         unsigned int s1 = pIn[i*3 + 1];
@@ -8134,19 +9553,163 @@ DRWAV_API void drwav_s24_to_s32(drwav_int32* pOut, const drwav_uint8* pIn, size_
     }
 }
 
-DRWAV_API void drwav_f32_to_s32(drwav_int32* pOut, const float* pIn, size_t sampleCount)
+#if defined(DRWAV_SUPPORT_AVX2)
+DRWAV_PRIVATE void drwav_s24_to_s32__avx2(drwav_int32* pOut, const drwav_uint8* pIn, size_t sampleCount)
+{
+    size_t i;
+
+    for (i = 0; i + 10 <= sampleCount; i += 8) {
+        _mm256_storeu_si256((__m256i*)(pOut + i), drwav__mm256_unpack_s24(pIn + i*3));
+    }
+
+    drwav_s24_to_s32__scalar(pOut + i, pIn + i*3, sampleCount - i);
+}
+#endif
+
+#if defined(DRWAV_SUPPORT_SSE2)
+DRWAV_PRIVATE void drwav_s24_to_s32__sse2(drwav_int32* pOut, const drwav_uint8* pIn, size_t sampleCount)
+{
+    size_t i;
+
+    for (i = 0; i + 6 <= sampleCount; i += 4) {
+        _mm_storeu_si128((__m128i*)(pOut + i), drwav__mm_unpack_s24(_mm_loadu_si128((const __m128i*)(pIn + i*3))));
+    }
+
+    drwav_s24_to_s32__scalar(pOut + i, pIn + i*3, sampleCount - i);
+}
+#endif
+
+#if defined(DRWAV_SUPPORT_NEON)
+DRWAV_PRIVATE void drwav_s24_to_s32__neon(drwav_int32* pOut, const drwav_uint8* pIn, size_t sampleCount)
 {
     size_t i;
+    uint32x4_t lo;
+    uint32x4_t hi;
+
+    for (i = 0; i + 8 <= sampleCount; i += 8) {
+        drwav__neon_unpack_s24(pIn + i*3, &lo, &hi);
+        vst1q_s32(pOut + i + 0, vreinterpretq_s32_u32(lo));
+        vst1q_s32(pOut + i + 4, vreinterpretq_s32_u32(hi));
+    }
 
+    drwav_s24_to_s32__scalar(pOut + i, pIn + i*3, sampleCount - i);
+}
+#endif
+
+DRWAV_API void drwav_s24_to_s32(drwav_int32* pOut, const drwav_uint8* pIn, size_t sampleCount)
+{
     if (pOut == NULL || pIn == NULL) {
         return;
     }
 
+    drwav__init_cpu_caps();
+
+#if defined(DRWAV_SUPPORT_AVX2)
+    if (drwav__gIsAVX2Supported) {
+        drwav_s24_to_s32__avx2(pOut, pIn, sampleCount);
+        return;
+    }
+#endif
+
+#if defined(DRWAV_SUPPORT_SSE2)
+    if (drwav__gIsSSE2Supported) {
+        drwav_s24_to_s32__sse2(pOut, pIn, sampleCount);
+        return;
+    }
+#endif
+
+#if defined(DRWAV_SUPPORT_NEON)
+    if (drwav__gIsNEONSupported) {
+        drwav_s24_to_s32__neon(pOut, pIn, sampleCount);
+        return;
+    }
+#endif
+
+    drwav_s24_to_s32__scalar(pOut, pIn, sampleCount);
+}
+
+DRWAV_PRIVATE void drwav_f32_to_s32__scalar(drwav_int32* pOut, const float* pIn, size_t sampleCount)
+{
+    size_t i;
+
     for (i = 0; i < sampleCount; ++i) {
         *pOut++ = (drwav_int32)(2147483648.0f * pIn[i]);
     }
 }
 
+#if defined(DRWAV_SUPPORT_AVX2)
+DRWAV_PRIVATE void drwav_f32_to_s32__avx2(drwav_int32* pOut, const float* pIn, size_t sampleCount)
+{
+    size_t i;
+    const __m256 scale = _mm256_set1_ps(2147483648.0f);
+
+    for (i = 0; i + 8 <= sampleCount; i += 8) {
+        _mm256_storeu_si256((__m256i*)(pOut + i), _mm256_cvttps_epi32(_mm256_mul_ps(_mm256_loadu_ps(pIn + i), scale)));
+    }
+
+    drwav_f32_to_s32__scalar(pOut + i, pIn + i, sampleCount - i);
+}
+#endif
+
+#if defined(DRWAV_SUPPORT_SSE2)
+DRWAV_PRIVATE void drwav_f32_to_s32__sse2(drwav_int32* pOut, const float* pIn, size_t sampleCount)
+{
+    size_t i;
+    const __m128 scale = _mm_set1_ps(2147483648.0f);
+
+    for (i = 0; i + 4 <= sampleCount; i += 4) {
+        _mm_storeu_si128((__m128i*)(pOut + i), _mm_cvttps_epi32(_mm_mul_ps(_mm_loadu_ps(pIn + i), scale)));
+    }
+
+    drwav_f32_to_s32__scalar(pOut + i, pIn + i, sampleCount - i);
+}
+#endif
+
+#if defined(DRWAV_SUPPORT_NEON)
+DRWAV_PRIVATE void drwav_f32_to_s32__neon(drwav_int32* pOut, const float* pIn, size_t sampleCount)
+{
+    size_t i;
+
+    for (i = 0; i + 4 <= sampleCount; i += 4) {
+        vst1q_s32(pOut + i, vcvtq_s32_f32(vmulq_n_f32(vld1q_f32(pIn + i), 2147483648.0f)));
+    }
+
+    drwav_f32_to_s32__scalar(pOut + i, pIn + i, sampleCount - i);
+}
+#endif
+
+DRWAV_API void drwav_f32_to_s32(drwav_int32* pOut, const float* pIn, size_t sampleCount)
+{
+    if (pOut == NULL || pIn == NULL) {
+        return;
+    }
+
+    drwav__init_cpu_caps();
+
+#if defined(DRWAV_SUPPORT_AVX2)
+    if (drwav__gIsAVX2Supported) {
+        drwav_f32_to_s32__avx2(pOut, pIn, sampleCount);
+        return;
+    }
+#endif
+
+#if defined(DRWAV_SUPPORT_SSE2)
+    if (drwav__gIsSSE2Supported) {
+        drwav_f32_to_s32__sse2(pOut, pIn, sampleCount);
+        return;
+    }
+#endif
+
+#if defined(DRWAV_SUPPORT_NEON)
+    if (drwav__gIsNEONSupported) {
+        drwav_f32_to_s32__neon(pOut, pIn, sampleCount);
+        return;
+    }
+#endif
+
+    drwav_f32_to_s32__scalar(pOut, pIn, sampleCount);
+}
+
 DRWAV_API void drwav_f64_to_s32(drwav_int32* pOut, const double* pIn, size_t sampleCount)
 {
     size_t i;
@@ -8689,6 +10252,11 @@ v0.14.6 - TBD
   - Fix an error when converting from >32 bit samples to s16/f32/s32 on big-endian architectures.
   - Fix an error with conversion from u8, 16, alaw and mulaw to s32.
   - Add some bound checking when processing metadata chunks.
+  - Seeking in MS-ADPCM and IMA-ADPCM files now jumps straight to the block containing the target frame instead of decoding from the start.
+  - Add `drwav_init_file_mmap()`, `drwav_init_file_mmap_ex()` and their `_w` variants for reading from a memory mapped file. Disable with `DR_WAV_NO_MMAP`.
+  - Add `drwav_map_pcm_frames()` for accessing uncompressed sample data in memory backed streams without a copy.
+  - Conversion to s16, f32 and s32 now reads straight from the buffer for memory backed streams.
+  - Add SSE2, AVX2 and NEON optimized sample format conversion routines. Disable with `DR_WAV_NO_SIMD`.
 
 v0.14.5 - 2026-03-03
   - Fix a crash when loading files with a malformed "smpl" chunk.
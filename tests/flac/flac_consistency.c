@@ -0,0 +1,1244 @@
+/*
+This test checks that the different ways of getting audio out of dr_flac are consistent with each other. Everything is compared
+against a plain drflac_read_pcm_frames_s32() of the whole file so, unlike the other FLAC tests, this does not need libFLAC.
+
+  - Push mode decoding with drflac_decode_frame_s32(), with the data being delivered in chunks of random sizes.
+  - Planar output against interleaved output.
+  - Decoders created with drflac_open_memory_clone() against the decoder they were cloned from, with seeking.
+  - Seeking with the frame cache enabled.
+  - The multithreaded `_mt` APIs against a single threaded decode.
+  - Seeking with a seek index that has been saved and loaded back in, and rejecting seek index data that is truncated or corrupt.
+
+A generated stream with LPC subframes of every order is also checked against the samples it was generated from, once for each of
+the SIMD code paths the CPU supports. This covers high orders and both 32- and 64-bit prediction which the test vectors don't. The
+same stream with a corrupted frame is used to check that the CRC-16 rejects it, and that it's decoded once verification is off.
+*/
+#define DR_FLAC_IMPLEMENTATION
+#include "../../dr_flac.h"
+
+#include "../common/dr_common.c"
+
+#define FILE_NAME_WIDTH 40
+#define NUMBER_WIDTH    10
+#define TABLE_MARGIN    2
+
+#define DEFAULT_SOURCE_DIR  "tests/testvectors/flac/testbench"
+
+/* Decodes everything that's left in the stream. The returned buffer needs to be freed with free(). */
+static drflac_int32* read_remaining_pcm_frames_s32(drflac* pFlac, drflac_uint64* pPCMFrameCount)
+{
+    drflac_int32* pPCMFrames = NULL;
+    drflac_uint64 pcmFrameCount = 0;
+    drflac_uint64 pcmFrameCap = 0;
+
+    for (;;) {
+        drflac_uint64 pcmFramesRead;
+
+        if (pcmFrameCount + 4096 > pcmFrameCap) {
+            drflac_int32* pNewPCMFrames;
+
+            pcmFrameCap = (pcmFrameCap == 0) ? 65536 : pcmFrameCap * 2;
+            pNewPCMFrames = (drflac_int32*)realloc(pPCMFrames, (size_t)(pcmFrameCap * pFlac->channels * sizeof(drflac_int32)));
+            if (pNewPCMFrames == NULL) {
+                free(pPCMFrames);
+                return NULL;
+            }
+
+            pPCMFrames = pNewPCMFrames;
+        }
+
+        pcmFramesRead = drflac_read_pcm_frames_s32(pFlac, 4096, pPCMFrames + (pcmFrameCount * pFlac->channels));
+        if (pcmFramesRead == 0) {
+            break;
+        }
+
+        pcmFrameCount += pcmFramesRead;
+    }
+
+    *pPCMFrameCount = pcmFrameCount;
+    return pPCMFrames;
+}
+
+/* Checks that the decoder is sitting on the given PCM frame by reading a chunk and comparing it to the reference. */
+static drflac_result compare_next_pcm_frames(drflac* pFlac, const drflac_int32* pReference, drflac_uint64 referencePCMFrameCount, drflac_uint64 pcmFrameIndex, const char* pName)
+{
+    drflac_int32 pcmFrames[4096 * 8];
+    drflac_uint64 pcmFramesToRead;
+    drflac_uint64 pcmFramesRead;
+
+    pcmFramesToRead = (sizeof(pcmFrames) / sizeof(pcmFrames[0])) / pFlac->channels;
+    if (pcmFramesToRead > referencePCMFrameCount - pcmFrameIndex) {
+        pcmFramesToRead = referencePCMFrameCount - pcmFrameIndex;
+    }
+
+    pcmFramesRead = drflac_read_pcm_frames_s32(pFlac, pcmFramesToRead, pcmFrames);
+    if (pcmFramesRead != pcmFramesToRead) {
+        printf("  [%s] Expecting %d PCM frames @ %d, but got %d", pName, (int)pcmFramesToRead, (int)pcmFrameIndex, (int)pcmFramesRead);
+        return DRFLAC_ERROR;
+    }
+
+    if (memcmp(pcmFrames, pReference + (pcmFrameIndex * pFlac->channels), (size_t)(pcmFramesRead * pFlac->channels * sizeof(drflac_int32))) != 0) {
+        printf("  [%s] PCM frames differ @ %d", pName, (int)pcmFrameIndex);
+        return DRFLAC_ERROR;
+    }
+
+    return DRFLAC_SUCCESS;
+}
+
+
+drflac_result test_push(const drflac_uint8* pData, size_t dataSize, const drflac* pFlac, const drflac_int32* pReference, drflac_uint64 referencePCMFrameCount)
+{
+    drflac_result result = DRFLAC_SUCCESS;
+    drflac_streaminfo streaminfo;
+    drflac_int32* pDecodedSamples;
+    drflac_int32* ppDecodedChannels[8];
+    drflac_uint8* pPending;
+    size_t pendingSize = 0;
+    size_t dataPos;
+    drflac_uint64 pcmFrameCount = 0;
+    drflac_uint32 iChannel;
+
+    /* Push mode only deals with raw FLAC frames. */
+    if (pFlac->container != drflac_container_native) {
+        return DRFLAC_SUCCESS;
+    }
+
+    DRFLAC_ZERO_MEMORY(&streaminfo, sizeof(streaminfo));
+    streaminfo.channels                = (drflac_uint8)pFlac->channels;
+    streaminfo.bitsPerSample           = pFlac->bitsPerSample;
+    streaminfo.maxBlockSizeInPCMFrames = pFlac->maxBlockSizeInPCMFrames;
+
+    pDecodedSamples = (drflac_int32*)malloc((size_t)pFlac->maxBlockSizeInPCMFrames * pFlac->channels * sizeof(drflac_int32));
+    pPending = (drflac_uint8*)malloc(dataSize);
+    if (pDecodedSamples == NULL || pPending == NULL) {
+        free(pDecodedSamples);
+        free(pPending);
+        printf("  [Push] Out of memory");
+        return DRFLAC_ERROR;
+    }
+
+    for (iChannel = 0; iChannel < pFlac->channels; iChannel += 1) {
+        ppDecodedChannels[iChannel] = pDecodedSamples + (iChannel * pFlac->maxBlockSizeInPCMFrames);
+    }
+
+    /* The data is delivered in chunks of random sizes. Whatever isn't consumed is kept for the next call, just like a real stream. */
+    dataPos = (size_t)pFlac->firstFLACFramePosInBytes;
+    while (result == DRFLAC_SUCCESS) {
+        size_t chunkSize = (size_t)dr_rand_range_s32(1, 8192);
+        if (chunkSize > dataSize - dataPos) {
+            chunkSize = dataSize - dataPos;
+        }
+
+        memcpy(pPending + pendingSize, pData + dataPos, chunkSize);
+        pendingSize += chunkSize;
+        dataPos     += chunkSize;
+
+        for (;;) {
+            drflac_uint32 pcmFramesDecoded;
+            size_t bytesConsumed;
+
+            pcmFramesDecoded = drflac_decode_frame_s32(&streaminfo, pPending, pendingSize, ppDecodedChannels, NULL, &bytesConsumed);
+            if (pcmFramesDecoded == 0 && bytesConsumed == 0) {
+                break;  /* Need more data. */
+            }
+
+            if (pcmFramesDecoded > 0) {
+                drflac_uint32 iPCMFrame;
+
+                if (pcmFrameCount + pcmFramesDecoded > referencePCMFrameCount) {
+                    printf("  [Push] Too many PCM frames");
+                    result = DRFLAC_ERROR;
+                    break;
+                }
+
+                for (iPCMFrame = 0; iPCMFrame < pcmFramesDecoded && result == DRFLAC_SUCCESS; iPCMFrame += 1) {
+                    for (iChannel = 0; iChannel < pFlac->channels; iChannel += 1) {
+                        if (ppDecodedChannels[iChannel][iPCMFrame] != pReference[(pcmFrameCount + iPCMFrame) * pFlac->channels + iChannel]) {
+                            printf("  [Push] PCM frames differ @ %d", (int)(pcmFrameCount + iPCMFrame));
+                            result = DRFLAC_ERROR;
+                            break;
+                        }
+                    }
+                }
+
+                pcmFrameCount += pcmFramesDecoded;
+            }
+
+            memmove(pPending, pPending + bytesConsumed, pendingSize - bytesConsumed);
+            pendingSize -= bytesConsumed;
+        }
+
+        if (dataPos == dataSize) {
+            break;
+        }
+    }
+
+    if (result == DRFLAC_SUCCESS && pcmFrameCount != referencePCMFrameCount) {
+        printf("  [Push] Expecting %d PCM frames, but got %d", (int)referencePCMFrameCount, (int)pcmFrameCount);
+        result = DRFLAC_ERROR;
+    }
+
+    free(pDecodedSamples);
+    free(pPending);
+    return result;
+}
+
+drflac_result test_planar(const drflac_uint8* pData, size_t dataSize)
+{
+    /* Each format is read from two decoders in the same sized chunks, one interleaved and the other planar. */
+    drflac_result result = DRFLAC_SUCCESS;
+    drflac* pFlacInterleaved;
+    drflac* pFlacPlanar;
+    int format;
+
+    for (format = 0; format < 3 && result == DRFLAC_SUCCESS; format += 1) {
+        union { drflac_int32 s32[4096 * 8]; drflac_int16 s16[4096 * 8]; float f32[4096 * 8]; } interleaved;
+        union { drflac_int32 s32[4096 * 8]; drflac_int16 s16[4096 * 8]; float f32[4096 * 8]; } planar;
+
+        pFlacInterleaved = drflac_open_memory(pData, dataSize, NULL);
+        pFlacPlanar      = drflac_open_memory(pData, dataSize, NULL);
+        if (pFlacInterleaved == NULL || pFlacPlanar == NULL) {
+            drflac_close(pFlacInterleaved);
+            drflac_close(pFlacPlanar);
+            printf("  [Planar] Failed to open decoder");
+            return DRFLAC_ERROR;
+        }
+
+        for (;;) {
+            drflac_int32* ppPlanarS32[8];
+            drflac_int16* ppPlanarS16[8];
+            float*        ppPlanarF32[8];
+            drflac_uint64 pcmFramesToRead = (drflac_uint64)dr_rand_range_s32(1, 4096);
+            drflac_uint64 pcmFramesReadInterleaved;
+            drflac_uint64 pcmFramesReadPlanar;
+            drflac_uint64 iPCMFrame;
+            drflac_uint32 iChannel;
+
+            for (iChannel = 0; iChannel < pFlacPlanar->channels; iChannel += 1) {
+                ppPlanarS32[iChannel] = planar.s32 + (iChannel * pcmFramesToRead);
+                ppPlanarS16[iChannel] = planar.s16 + (iChannel * pcmFramesToRead);
+                ppPlanarF32[iChannel] = planar.f32 + (iChannel * pcmFramesToRead);
+            }
+
+            if (format == 0) {
+                pcmFramesReadInterleaved = drflac_read_pcm_frames_s32(pFlacInterleaved, pcmFramesToRead, interleaved.s32);
+                pcmFramesReadPlanar      = drflac_read_pcm_frames_s32_planar(pFlacPlanar, pcmFramesToRead, ppPlanarS32);
+            } else if (format == 1) {
+                pcmFramesReadInterleaved = drflac_read_pcm_frames_s16(pFlacInterleaved, pcmFramesToRead, interleaved.s16);
+                pcmFramesReadPlanar      = drflac_read_pcm_frames_s16_planar(pFlacPlanar, pcmFramesToRead, ppPlanarS16);
+            } else {
+                pcmFramesReadInterleaved = drflac_read_pcm_frames_f32(pFlacInterleaved, pcmFramesToRead, interleaved.f32);
+                pcmFramesReadPlanar      = drflac_read_pcm_frames_f32_planar(pFlacPlanar, pcmFramesToRead, ppPlanarF32);
+            }
+
+            if (pcmFramesReadInterleaved != pcmFramesReadPlanar) {
+                printf("  [Planar] Frame counts differ: interleaved = %d; planar = %d", (int)pcmFramesReadInterleaved, (int)pcmFramesReadPlanar);
+                result = DRFLAC_ERROR;
+                break;
+            }
+
+            for (iPCMFrame = 0; iPCMFrame < pcmFramesReadPlanar && result == DRFLAC_SUCCESS; iPCMFrame += 1) {
+                for (iChannel = 0; iChannel < pFlacPlanar->channels; iChannel += 1) {
+                    drflac_uint64 iSample = iPCMFrame*pFlacPlanar->channels + iChannel;
+                    drflac_bool32 isEqual;
+
+                    if (format == 0) {
+                        isEqual = interleaved.s32[iSample] == ppPlanarS32[iChannel][iPCMFrame];
+                    } else if (format == 1) {
+                        isEqual = interleaved.s16[iSample] == ppPlanarS16[iChannel][iPCMFrame];
+                    } else {
+                        isEqual = memcmp(&interleaved.f32[iSample], &ppPlanarF32[iChannel][iPCMFrame], sizeof(float)) == 0;
+                    }
+
+                    if (!isEqual) {
+                        printf("  [Planar] Samples differ (format %d) @ %d[%d]", format, (int)(pFlacPlanar->currentPCMFrame - pcmFramesReadPlanar + iPCMFrame), (int)iChannel);
+                        result = DRFLAC_ERROR;
+                        break;
+                    }
+                }
+            }
+
+            if (pcmFramesReadPlanar == 0) {
+                break;
+            }
+        }
+
+        drflac_close(pFlacInterleaved);
+        drflac_close(pFlacPlanar);
+    }
+
+    return result;
+}
+
+drflac_result test_clone(drflac* pFlac, const drflac_int32* pReference, drflac_uint64 referencePCMFrameCount)
+{
+    drflac_result result = DRFLAC_SUCCESS;
+    drflac* pClones[2];
+    drflac_uint32 iIteration;
+
+    pClones[0] = drflac_open_memory_clone(pFlac, NULL);
+    pClones[1] = drflac_open_memory_clone(pFlac, NULL);
+    if (pClones[0] == NULL || pClones[1] == NULL) {
+        drflac_close(pClones[0]);
+        drflac_close(pClones[1]);
+        printf("  [Clone] Failed to clone decoder");
+        return DRFLAC_ERROR;
+    }
+
+    if (pClones[0]->channels != pFlac->channels || pClones[0]->sampleRate != pFlac->sampleRate || pClones[0]->totalPCMFrameCount != pFlac->totalPCMFrameCount) {
+        printf("  [Clone] Properties differ");
+        result = DRFLAC_ERROR;
+    }
+
+    /* A fresh clone sits on the first PCM frame regardless of where the source decoder is. */
+    if (result == DRFLAC_SUCCESS) {
+        result = compare_next_pcm_frames(pClones[0], pReference, referencePCMFrameCount, 0, "Clone");
+    }
+
+    /* The clones and the source are used in turns to make sure none of them are sharing any state that they shouldn't. */
+    for (iIteration = 0; iIteration < 30 && result == DRFLAC_SUCCESS; iIteration += 1) {
+        drflac* pDecoder = (iIteration % 3 == 2) ? pFlac : pClones[iIteration % 3];
+        drflac_uint64 targetPCMFrame = dr_rand_range_u64(0, referencePCMFrameCount);
+
+        if (!drflac_seek_to_pcm_frame(pDecoder, targetPCMFrame)) {
+            printf("  [Clone] Failed to seek to PCM frame @ %d", (int)targetPCMFrame);
+            result = DRFLAC_ERROR;
+            break;
+        }
+
+        result = compare_next_pcm_frames(pDecoder, pReference, referencePCMFrameCount, targetPCMFrame, "Clone");
+    }
+
+    drflac_close(pClones[0]);
+    drflac_close(pClones[1]);
+    return result;
+}
+
+drflac_result test_frame_cache(const drflac_uint8* pData, size_t dataSize, const drflac_int32* pReference, drflac_uint64 referencePCMFrameCount)
+{
+    drflac_result result = DRFLAC_SUCCESS;
+    drflac* pFlac;
+    drflac_uint32 iIteration;
+    drflac_uint64 scrubPCMFrame = 0;
+
+    pFlac = drflac_open_memory(pData, dataSize, NULL);
+    if (pFlac == NULL) {
+        printf("  [Cache] Failed to open decoder");
+        return DRFLAC_ERROR;
+    }
+
+    /* Small enough that the cache needs to evict FLAC frames on longer files. */
+    if (!drflac_enable_frame_cache(pFlac, (size_t)pFlac->maxBlockSizeInPCMFrames * pFlac->channels * sizeof(drflac_int32) * 16 + 4096)) {
+        drflac_close(pFlac);
+        printf("  [Cache] Failed to enable frame cache");
+        return DRFLAC_ERROR;
+    }
+
+    /* This simulates scrubbing, where most seeks are close to the previous one, with the occasional jump to somewhere else. */
+    for (iIteration = 0; iIteration < 100 && result == DRFLAC_SUCCESS; iIteration += 1) {
+        drflac_uint64 targetPCMFrame;
+
+        if (iIteration % 10 == 0) {
+            scrubPCMFrame = dr_rand_range_u64(0, referencePCMFrameCount);
+        }
+
+        targetPCMFrame = scrubPCMFrame + (drflac_uint64)dr_rand_range_s32(0, (int)pFlac->maxBlockSizeInPCMFrames * 4);
+        if (targetPCMFrame > referencePCMFrameCount) {
+            targetPCMFrame = referencePCMFrameCount;
+        }
+
+        if (!drflac_seek_to_pcm_frame(pFlac, targetPCMFrame)) {
+            printf("  [Cache] Failed to seek to PCM frame @ %d", (int)targetPCMFrame);
+            result = DRFLAC_ERROR;
+            break;
+        }
+
+        result = compare_next_pcm_frames(pFlac, pReference, referencePCMFrameCount, targetPCMFrame, "Cache");
+    }
+
+    drflac_close(pFlac);
+    return result;
+}
+
+drflac_result test_mt(const char* pFilePath, const drflac_uint8* pData, size_t dataSize, const drflac_int32* pReference, drflac_uint64 referencePCMFrameCount)
+{
+    drflac_result result = DRFLAC_SUCCESS;
+    drflac_uint32 threadCounts[] = {0, 2, 3, 8};
+    drflac_uint32 iThreadCount;
+    unsigned int channels;
+    unsigned int sampleRate;
+    drflac_uint64 pcmFrameCountST;
+    drflac_uint64 pcmFrameCountMT;
+    drflac_int16* pS16;
+    float* pF32;
+
+    /* The s16 and f32 versions are compared to the single threaded version of the same format to avoid rounding differences. */
+    pS16 = drflac_open_memory_and_read_pcm_frames_s16(pData, dataSize, &channels, &sampleRate, &pcmFrameCountST, NULL);
+    pF32 = drflac_open_memory_and_read_pcm_frames_f32(pData, dataSize, &channels, &sampleRate, &pcmFrameCountST, NULL);
+    if (pS16 == NULL || pF32 == NULL) {
+        drflac_free(pS16, NULL);
+        drflac_free(pF32, NULL);
+        printf("  [MT] Single threaded decode failed");
+        return DRFLAC_ERROR;
+    }
+
+    for (iThreadCount = 0; iThreadCount < sizeof(threadCounts) / sizeof(threadCounts[0]) && result == DRFLAC_SUCCESS; iThreadCount += 1) {
+        drflac_uint32 threadCount = threadCounts[iThreadCount];
+        int iVariant;
+
+        for (iVariant = 0; iVariant < 4 && result == DRFLAC_SUCCESS; iVariant += 1) {
+            void* pMT;
+            const void* pST;
+            size_t bytesPerSample;
+
+            switch (iVariant) {
+                case 0:  pMT = drflac_open_memory_and_read_pcm_frames_s32_mt(pData, dataSize, threadCount, &channels, &sampleRate, &pcmFrameCountMT, NULL); pST = pReference; bytesPerSample = 4; break;
+                case 1:  pMT = drflac_open_memory_and_read_pcm_frames_s16_mt(pData, dataSize, threadCount, &channels, &sampleRate, &pcmFrameCountMT, NULL); pST = pS16;       bytesPerSample = 2; break;
+                case 2:  pMT = drflac_open_memory_and_read_pcm_frames_f32_mt(pData, dataSize, threadCount, &channels, &sampleRate, &pcmFrameCountMT, NULL); pST = pF32;       bytesPerSample = 4; break;
+                default: pMT = drflac_open_file_and_read_pcm_frames_s32_mt(pFilePath, threadCount, &channels, &sampleRate, &pcmFrameCountMT, NULL);          pST = pReference; bytesPerSample = 4; break;
+            }
+
+            if (pMT == NULL) {
+                printf("  [MT] Decode failed (variant %d, %d threads)", iVariant, (int)threadCount);
+                result = DRFLAC_ERROR;
+                break;
+            }
+
+            if (pcmFrameCountMT != referencePCMFrameCount || memcmp(pMT, pST, (size_t)(referencePCMFrameCount * channels * bytesPerSample)) != 0) {
+                printf("  [MT] Output differs from single threaded decode (variant %d, %d threads)", iVariant, (int)threadCount);
+                result = DRFLAC_ERROR;
+            }
+
+            drflac_free(pMT, NULL);
+        }
+    }
+
+    drflac_free(pS16, NULL);
+    drflac_free(pF32, NULL);
+    return result;
+}
+
+static drflac_result seek_randomly_and_compare(drflac* pFlac, const drflac_int32* pReference, drflac_uint64 referencePCMFrameCount, const char* pName)
+{
+    drflac_result result = DRFLAC_SUCCESS;
+    drflac_uint32 iIteration;
+
+    for (iIteration = 0; iIteration < 100 && result == DRFLAC_SUCCESS; iIteration += 1) {
+        drflac_uint64 targetPCMFrame;
+
+        /* The start and the end are always checked. */
+        if (iIteration == 0) {
+            targetPCMFrame = 0;
+        } else if (iIteration == 1) {
+            targetPCMFrame = referencePCMFrameCount;
+        } else {
+            targetPCMFrame = dr_rand_range_u64(0, referencePCMFrameCount);
+        }
+
+        if (!drflac_seek_to_pcm_frame(pFlac, targetPCMFrame)) {
+            printf("  [%s] Failed to seek to PCM frame @ %d", pName, (int)targetPCMFrame);
+            return DRFLAC_ERROR;
+        }
+
+        result = compare_next_pcm_frames(pFlac, pReference, referencePCMFrameCount, targetPCMFrame, pName);
+    }
+
+    return result;
+}
+
+static drflac_bool32 is_seek_index_rejected(drflac* pFlac, const drflac_uint8* pIndexData, size_t indexDataSize)
+{
+    drflac_bool32 isRejected = !drflac_load_seek_index(pFlac, pIndexData, indexDataSize);
+
+    /* A failed load must leave the decoder without an index since none was loaded beforehand. */
+    return isRejected && drflac_save_seek_index(pFlac, NULL, 0) == 0;
+}
+
+drflac_result test_seek_index(const drflac_uint8* pData, size_t dataSize, const drflac_int32* pReference, drflac_uint64 referencePCMFrameCount)
+{
+    drflac_result result = DRFLAC_SUCCESS;
+    drflac* pFlac;
+    drflac* pFlacLoaded = NULL;
+    drflac_uint8* pIndexData = NULL;
+    drflac_uint8* pCorruptIndexData = NULL;
+    size_t indexDataSize;
+    size_t iByte;
+    int iTruncation;
+
+    pFlac = drflac_open_memory(pData, dataSize, NULL);
+    if (pFlac == NULL) {
+        printf("  [Seek Index] Failed to open decoder");
+        return DRFLAC_ERROR;
+    }
+
+    /* Seek indices are not supported with Ogg. */
+    if (pFlac->container == drflac_container_ogg) {
+        if (drflac_build_seek_index(pFlac)) {
+            printf("  [Seek Index] Expecting building a seek index to fail with Ogg");
+            result = DRFLAC_ERROR;
+        }
+
+        drflac_close(pFlac);
+        return result;
+    }
+
+    if (!drflac_build_seek_index(pFlac)) {
+        printf("  [Seek Index] Failed to build seek index");
+        result = DRFLAC_ERROR;
+        goto done;
+    }
+
+    /* The size is queried first. Anything smaller than that must fail without writing anything. */
+    indexDataSize = drflac_save_seek_index(pFlac, NULL, 0);
+    pIndexData    = (drflac_uint8*)malloc(indexDataSize + 1);
+    if (indexDataSize <= DRFLAC_SEEK_INDEX_HEADER_SIZE || drflac_save_seek_index(pFlac, pIndexData, indexDataSize - 1) != 0 || drflac_save_seek_index(pFlac, pIndexData, indexDataSize) != indexDataSize) {
+        printf("  [Seek Index] Failed to save seek index");
+        result = DRFLAC_ERROR;
+        goto done;
+    }
+
+    result = seek_randomly_and_compare(pFlac, pReference, referencePCMFrameCount, "Seek Index");
+    if (result != DRFLAC_SUCCESS) {
+        goto done;
+    }
+
+    pFlacLoaded = drflac_open_memory(pData, dataSize, NULL);
+    if (pFlacLoaded == NULL) {
+        printf("  [Seek Index] Failed to open decoder");
+        result = DRFLAC_ERROR;
+        goto done;
+    }
+
+    /* Truncated data, starting with every length that cuts into the header or the first few entries. */
+    for (iTruncation = 0; iTruncation < 200; iTruncation += 1) {
+        size_t truncatedSize = (iTruncation < 64) ? (size_t)iTruncation : (size_t)dr_rand_range_u64(0, indexDataSize - 1);
+        if (truncatedSize >= indexDataSize) {
+            truncatedSize = indexDataSize - 1;
+        }
+
+        if (!is_seek_index_rejected(pFlacLoaded, pIndexData, truncatedSize)) {
+            printf("  [Seek Index] Expecting seek index truncated to %d bytes to be rejected", (int)truncatedSize);
+            result = DRFLAC_ERROR;
+            goto done;
+        }
+    }
+
+    /* Every byte of the header needs to match the stream, and the entry count needs to match the data that follows. */
+    pCorruptIndexData = (drflac_uint8*)malloc(indexDataSize + 1);
+    for (iByte = 0; iByte < DRFLAC_SEEK_INDEX_HEADER_SIZE; iByte += 1) {
+        memcpy(pCorruptIndexData, pIndexData, indexDataSize);
+        pCorruptIndexData[iByte] ^= 0xFF;
+
+        if (!is_seek_index_rejected(pFlacLoaded, pCorruptIndexData, indexDataSize)) {
+            printf("  [Seek Index] Expecting seek index with byte %d of the header corrupted to be rejected", (int)iByte);
+            result = DRFLAC_ERROR;
+            goto done;
+        }
+    }
+
+    /* Trailing data. */
+    memcpy(pCorruptIndexData, pIndexData, indexDataSize);
+    pCorruptIndexData[indexDataSize] = 0;
+    if (!is_seek_index_rejected(pFlacLoaded, pCorruptIndexData, indexDataSize + 1)) {
+        printf("  [Seek Index] Expecting seek index with trailing data to be rejected");
+        result = DRFLAC_ERROR;
+        goto done;
+    }
+
+    /* A last entry that never terminates. */
+    pCorruptIndexData[indexDataSize - 1] |= 0x80;
+    if (!is_seek_index_rejected(pFlacLoaded, pCorruptIndexData, indexDataSize)) {
+        printf("  [Seek Index] Expecting seek index with an unterminated entry to be rejected");
+        result = DRFLAC_ERROR;
+        goto done;
+    }
+
+    /* A first entry with a block size of 0. */
+    memcpy(pCorruptIndexData, pIndexData, indexDataSize);
+    pCorruptIndexData[DRFLAC_SEEK_INDEX_HEADER_SIZE] = 0;
+    if (!is_seek_index_rejected(pFlacLoaded, pCorruptIndexData, indexDataSize)) {
+        printf("  [Seek Index] Expecting seek index with an empty FLAC frame to be rejected");
+        result = DRFLAC_ERROR;
+        goto done;
+    }
+
+    /* The real thing must load, save back out to exactly the same data, and seek the same as the decoder it was built with. */
+    if (!drflac_load_seek_index(pFlacLoaded, pIndexData, indexDataSize)) {
+        printf("  [Seek Index] Failed to load seek index");
+        result = DRFLAC_ERROR;
+        goto done;
+    }
+
+    memset(pCorruptIndexData, 0, indexDataSize);
+    if (drflac_save_seek_index(pFlacLoaded, pCorruptIndexData, indexDataSize) != indexDataSize || memcmp(pCorruptIndexData, pIndexData, indexDataSize) != 0) {
+        printf("  [Seek Index] Expecting a loaded seek index to save back out unchanged");
+        result = DRFLAC_ERROR;
+        goto done;
+    }
+
+    result = seek_randomly_and_compare(pFlacLoaded, pReference, referencePCMFrameCount, "Seek Index Loaded");
+
+done:
+    free(pCorruptIndexData);
+    free(pIndexData);
+    drflac_close(pFlacLoaded);
+    drflac_close(pFlac);
+    return result;
+}
+
+drflac_result test_file(const char* pFilePath)
+{
+    drflac_result result = DRFLAC_SUCCESS;
+    drflac_uint8* pData;
+    size_t dataSize;
+    drflac* pFlac;
+    drflac_int32* pReference;
+    drflac_uint64 referencePCMFrameCount;
+
+    dr_printf_fixed_with_margin(FILE_NAME_WIDTH, TABLE_MARGIN, "%s", dr_path_file_name(pFilePath));
+
+    pData = (drflac_uint8*)dr_open_and_read_file(pFilePath, &dataSize);
+    if (pData == NULL) {
+        printf("  Failed to open file.\n");
+        return DRFLAC_ERROR;
+    }
+
+    pFlac = drflac_open_memory(pData, dataSize, NULL);
+    if (pFlac == NULL) {
+        free(pData);
+        printf("  Failed to open via dr_flac.\n");
+        return DRFLAC_ERROR;
+    }
+
+    pReference = read_remaining_pcm_frames_s32(pFlac, &referencePCMFrameCount);
+    if (pReference == NULL) {
+        drflac_close(pFlac);
+        free(pData);
+        printf("  Out of memory.\n");
+        return DRFLAC_ERROR;
+    }
+
+    /* Everything is compared against the reference so it needs to be complete. This is the case for streams dr_flac can't decode, such as 32-bit ones. */
+    if (pFlac->totalPCMFrameCount != 0 && pFlac->totalPCMFrameCount != referencePCMFrameCount) {
+        printf("  Skipped (only %d of %d PCM frames could be decoded)\n", (int)referencePCMFrameCount, (int)pFlac->totalPCMFrameCount);
+        free(pReference);
+        drflac_close(pFlac);
+        free(pData);
+        return DRFLAC_SUCCESS;
+    }
+
+    dr_seed(1234);
+
+    if (result == DRFLAC_SUCCESS) {
+        result = test_push(pData, dataSize, pFlac, pReference, referencePCMFrameCount);
+    }
+    if (result == DRFLAC_SUCCESS) {
+        result = test_planar(pData, dataSize);
+    }
+    if (result == DRFLAC_SUCCESS) {
+        result = test_clone(pFlac, pReference, referencePCMFrameCount);
+    }
+    if (result == DRFLAC_SUCCESS) {
+        result = test_frame_cache(pData, dataSize, pReference, referencePCMFrameCount);
+    }
+    if (result == DRFLAC_SUCCESS) {
+        result = test_mt(pFilePath, pData, dataSize, pReference, referencePCMFrameCount);
+    }
+    if (result == DRFLAC_SUCCESS) {
+        result = test_seek_index(pData, dataSize, pReference, referencePCMFrameCount);
+    }
+
+    if (result == DRFLAC_SUCCESS) {
+        printf("  Passed\n");
+    } else {
+        printf("\n");
+    }
+
+    free(pReference);
+    drflac_close(pFlac);
+    free(pData);
+    return result;
+}
+
+/* Writes a FLAC stream a bit at a time, most significant bit first. */
+typedef struct
+{
+    drflac_uint8* pData;
+    size_t size;        /* In whole bytes. */
+    size_t capacity;
+    drflac_uint32 bitCount; /* The number of bits in the current, partially written, byte. */
+} flac_writer;
+
+static void flac_writer_write_bits(flac_writer* pWriter, drflac_uint64 value, drflac_uint32 bitCount)
+{
+    while (bitCount > 0) {
+        bitCount -= 1;
+
+        if (pWriter->bitCount == 0) {
+            if (pWriter->size == pWriter->capacity) {
+                pWriter->capacity = (pWriter->capacity == 0) ? 65536 : pWriter->capacity * 2;
+                pWriter->pData    = (drflac_uint8*)realloc(pWriter->pData, pWriter->capacity);
+            }
+
+            pWriter->pData[pWriter->size] = 0;
+            pWriter->size += 1;
+        }
+
+        pWriter->pData[pWriter->size - 1] |= (drflac_uint8)(((value >> bitCount) & 1) << (7 - pWriter->bitCount));
+        pWriter->bitCount = (pWriter->bitCount + 1) & 7;
+    }
+}
+
+static void flac_writer_write_signed_bits(flac_writer* pWriter, drflac_int64 value, drflac_uint32 bitCount)
+{
+    flac_writer_write_bits(pWriter, (drflac_uint64)value & (((drflac_uint64)1 << bitCount) - 1), bitCount);
+}
+
+static void flac_writer_write_rice(flac_writer* pWriter, drflac_int32 value, drflac_uint32 riceParam)
+{
+    drflac_uint32 zigzag = (value < 0) ? ~((drflac_uint32)value << 1) : ((drflac_uint32)value << 1);
+    drflac_uint32 quotient = zigzag >> riceParam;
+
+    while (quotient > 0) {
+        flac_writer_write_bits(pWriter, 0, 1);
+        quotient -= 1;
+    }
+
+    flac_writer_write_bits(pWriter, 1, 1);
+    flac_writer_write_bits(pWriter, zigzag, riceParam);
+}
+
+/* Frames are protected by a CRC-8 of the header and a CRC-16 of the whole frame. These are done the slow way so they don't depend on dr_flac. */
+static drflac_uint16 calculate_crc(const drflac_uint8* pData, size_t dataSize, drflac_uint16 polynomial, drflac_uint32 width)
+{
+    drflac_uint32 crc = 0;
+    drflac_uint32 topBit = (drflac_uint32)1 << (width - 1);
+    size_t iByte;
+    int iBit;
+
+    for (iByte = 0; iByte < dataSize; iByte += 1) {
+        crc ^= (drflac_uint32)pData[iByte] << (width - 8);
+        for (iBit = 0; iBit < 8; iBit += 1) {
+            crc = (crc & topBit) ? ((crc << 1) ^ polynomial) : (crc << 1);
+        }
+    }
+
+    return (drflac_uint16)(crc & ((topBit << 1) - 1));
+}
+
+static drflac_uint32 bit_length(drflac_uint32 value)
+{
+    drflac_uint32 length = 0;
+
+    while (value > 0) {
+        length += 1;
+        value >>= 1;
+    }
+
+    return length;
+}
+
+/* Writes a mono frame with a single LPC subframe. The samples are predicted in 64-bit the way the specification describes. */
+static void write_lpc_frame(flac_writer* pWriter, drflac_uint32 frameIndex, drflac_uint32 bitsPerSample, const drflac_int32* pSamples, drflac_uint32 sampleCount, drflac_uint32 order, drflac_uint32 precision, drflac_uint32 shift, const drflac_int32* pCoefficients, drflac_uint32 partitionOrder)
+{
+    size_t frameStart = pWriter->size;
+    drflac_uint32 partitionCount = 1 << partitionOrder;
+    drflac_uint32 iPartition;
+    drflac_uint32 iSample;
+    drflac_uint32 iCoefficient;
+
+    DRFLAC_ASSERT(pWriter->bitCount == 0);
+    DRFLAC_ASSERT(frameIndex < 128);  /* Frame numbers are UTF-8 encoded. Keep them to a single byte. */
+
+    /* Fixed block size, 16-bit block size at the end of the header, sample rate from STREAMINFO, mono. */
+    flac_writer_write_bits(pWriter, 0xFFF8, 16);
+    flac_writer_write_bits(pWriter, 7, 4);
+    flac_writer_write_bits(pWriter, 0, 4);
+    flac_writer_write_bits(pWriter, 0, 4);
+    flac_writer_write_bits(pWriter, (bitsPerSample == 16) ? 4 : 6, 3);
+    flac_writer_write_bits(pWriter, 0, 1);
+    flac_writer_write_bits(pWriter, frameIndex, 8);
+    flac_writer_write_bits(pWriter, sampleCount - 1, 16);
+    flac_writer_write_bits(pWriter, calculate_crc(pWriter->pData + frameStart, pWriter->size - frameStart, 0x07, 8), 8);
+
+    /* LPC subframe with no wasted bits. */
+    flac_writer_write_bits(pWriter, 0, 1);
+    flac_writer_write_bits(pWriter, 0x20 | (order - 1), 6);
+    flac_writer_write_bits(pWriter, 0, 1);
+
+    for (iSample = 0; iSample < order; iSample += 1) {
+        flac_writer_write_signed_bits(pWriter, pSamples[iSample], bitsPerSample);
+    }
+
+    flac_writer_write_bits(pWriter, precision - 1, 4);
+    flac_writer_write_signed_bits(pWriter, shift, 5);
+    for (iCoefficient = 0; iCoefficient < order; iCoefficient += 1) {
+        flac_writer_write_signed_bits(pWriter, pCoefficients[iCoefficient], precision);
+    }
+
+    /* The residual uses the 5-bit Rice parameters so there's enough room for the large residuals random coefficients give. */
+    flac_writer_write_bits(pWriter, 1, 2);
+    flac_writer_write_bits(pWriter, partitionOrder, 4);
+
+    for (iPartition = 0; iPartition < partitionCount; iPartition += 1) {
+        drflac_uint32 firstSample = (iPartition == 0) ? order : (iPartition * (sampleCount >> partitionOrder));
+        drflac_uint32 lastSample  = (iPartition + 1) * (sampleCount >> partitionOrder);
+        drflac_int32* pResiduals  = (drflac_int32*)malloc(sizeof(drflac_int32) * (lastSample - firstSample + 1));
+        drflac_uint32 maxZigzag   = 0;
+        drflac_uint32 riceParam;
+
+        for (iSample = firstSample; iSample < lastSample; iSample += 1) {
+            drflac_int64 prediction = 0;
+            drflac_int32 residual;
+
+            for (iCoefficient = 0; iCoefficient < order; iCoefficient += 1) {
+                prediction += (drflac_int64)pCoefficients[iCoefficient] * pSamples[iSample - iCoefficient - 1];
+            }
+
+            residual = (drflac_int32)(pSamples[iSample] - (prediction >> shift));
+            pResiduals[iSample - firstSample] = residual;
+
+            if (((residual < 0) ? ~((drflac_uint32)residual << 1) : ((drflac_uint32)residual << 1)) > maxZigzag) {
+                maxZigzag = (residual < 0) ? ~((drflac_uint32)residual << 1) : ((drflac_uint32)residual << 1);
+            }
+        }
+
+        /* A parameter a bit below the largest residual keeps the unary part short without every residual needing the maximum. */
+        riceParam = bit_length(maxZigzag);
+        riceParam = (riceParam > 2) ? riceParam - 2 : 0;
+        DRFLAC_ASSERT(riceParam < 31);
+
+        flac_writer_write_bits(pWriter, riceParam, 5);
+        for (iSample = firstSample; iSample < lastSample; iSample += 1) {
+            flac_writer_write_rice(pWriter, pResiduals[iSample - firstSample], riceParam);
+        }
+
+        free(pResiduals);
+    }
+
+    /* Byte alignment, then the CRC-16 of the whole frame. */
+    if (pWriter->bitCount > 0) {
+        flac_writer_write_bits(pWriter, 0, 8 - pWriter->bitCount);
+    }
+
+    flac_writer_write_bits(pWriter, calculate_crc(pWriter->pData + frameStart, pWriter->size - frameStart, 0x8005, 16), 16);
+}
+
+/*
+Generates a mono stream with one frame for each LPC order from 1 to 32. When use64BitPrediction is false the coefficient precision
+is the largest that still keeps the prediction in 32 bits. Otherwise it's the maximum of 15 which needs 64 bits for everything but
+the lowest orders. The coefficients are random over their full range which pushes the prediction right up to the limit. The byte
+offset of each frame is output to pFrameOffsets if it's not NULL.
+*/
+static drflac_uint8* generate_lpc_stream(drflac_uint32 bitsPerSample, drflac_bool32 use64BitPrediction, drflac_int32** ppSamples, drflac_uint64* pSampleCount, size_t* pFrameOffsets, size_t* pDataSize)
+{
+    const drflac_uint32 blockSize = 1152;
+    const drflac_uint32 maxOrder  = 32;
+    drflac_int32 minSample = -(1 << (bitsPerSample - 1));
+    drflac_int32 maxSample =  (1 << (bitsPerSample - 1)) - 1;
+    drflac_uint32 lastBlockSize = blockSize - 300;    /* The last frame is a short one. */
+    drflac_uint64 sampleCount = (drflac_uint64)blockSize * (maxOrder - 1) + lastBlockSize;
+    drflac_int32* pSamples = (drflac_int32*)malloc((size_t)sampleCount * sizeof(drflac_int32));
+    flac_writer writer;
+    drflac_uint64 iSample;
+    drflac_uint32 order;
+
+    /* A random walk with the occasional jump to either extreme. */
+    pSamples[0] = 0;
+    for (iSample = 1; iSample < sampleCount; iSample += 1) {
+        drflac_int32 step = 1 << (bitsPerSample - 4);
+        drflac_int32 sample;
+
+        switch (dr_rand_range_s32(0, 63)) {
+            case 0:  sample = minSample; break;
+            case 1:  sample = maxSample; break;
+            default: sample = pSamples[iSample - 1] + dr_rand_range_s32(-step, step); break;
+        }
+
+        pSamples[iSample] = (sample < minSample) ? minSample : ((sample > maxSample) ? maxSample : sample);
+    }
+
+    DRFLAC_ZERO_OBJECT(&writer);
+
+    /* STREAMINFO: block sizes, unknown frame sizes, 44100Hz, mono, sample size, sample count and no MD5. */
+    flac_writer_write_bits(&writer, 0x664C6143, 32);   /* "fLaC" */
+    flac_writer_write_bits(&writer, 1, 1);
+    flac_writer_write_bits(&writer, DRFLAC_METADATA_BLOCK_TYPE_STREAMINFO, 7);
+    flac_writer_write_bits(&writer, 34, 24);
+    flac_writer_write_bits(&writer, blockSize, 16);
+    flac_writer_write_bits(&writer, blockSize, 16);
+    flac_writer_write_bits(&writer, 0, 24);
+    flac_writer_write_bits(&writer, 0, 24);
+    flac_writer_write_bits(&writer, 44100, 20);
+    flac_writer_write_bits(&writer, 0, 3);
+    flac_writer_write_bits(&writer, bitsPerSample - 1, 5);
+    flac_writer_write_bits(&writer, sampleCount, 36);
+    flac_writer_write_bits(&writer, 0, 64);
+    flac_writer_write_bits(&writer, 0, 64);
+
+    for (order = 1; order <= maxOrder; order += 1) {
+        drflac_int32 coefficients[32];
+        drflac_uint32 precision;
+        drflac_uint32 shift;
+        drflac_uint32 partitionOrder;
+        drflac_uint32 thisBlockSize = (order < maxOrder) ? blockSize : lastBlockSize;
+        drflac_uint32 iCoefficient;
+
+        precision = use64BitPrediction ? 15 : (32 - bitsPerSample - drflac__ilog2_u32(order));
+        if (precision > 15) {
+            precision = 15;
+        }
+
+        /* At 16 bits the lowest orders fit in 32 bits even at the maximum precision. */
+        DRFLAC_ASSERT(drflac__use_64_bit_prediction(bitsPerSample, order, precision) == (use64BitPrediction && (bitsPerSample + 15 + drflac__ilog2_u32(order) > 32)));
+
+        shift = (precision > 1) ? precision - 1 : 0;
+        for (iCoefficient = 0; iCoefficient < order; iCoefficient += 1) {
+            coefficients[iCoefficient] = dr_rand_range_s32(-(1 << (precision - 1)), (1 << (precision - 1)) - 1);
+        }
+
+        /* The first partition needs to be big enough for the warm up samples. */
+        partitionOrder = (drflac_uint32)dr_rand_range_s32(0, 4);
+        while ((thisBlockSize >> partitionOrder) < order || (thisBlockSize & ((1 << partitionOrder) - 1)) != 0) {
+            partitionOrder -= 1;
+        }
+
+        if (pFrameOffsets != NULL) {
+            pFrameOffsets[order - 1] = writer.size;
+        }
+
+        write_lpc_frame(&writer, order - 1, bitsPerSample, pSamples + (size_t)blockSize * (order - 1), thisBlockSize, order, precision, shift, coefficients, partitionOrder);
+    }
+
+    *ppSamples    = pSamples;
+    *pSampleCount = sampleCount;
+    *pDataSize    = writer.size;
+    return writer.pData;
+}
+
+static drflac_result decode_and_compare_lpc_stream(const drflac_uint8* pData, size_t dataSize, drflac_uint32 bitsPerSample, const drflac_int32* pSamples, drflac_uint64 sampleCount, const char* pPathName)
+{
+    drflac* pFlac;
+    drflac_int32* pDecoded;
+    drflac_uint64 decodedCount;
+    drflac_uint64 iSample;
+    drflac_result result = DRFLAC_SUCCESS;
+
+    pFlac = drflac_open_memory(pData, dataSize, NULL);
+    if (pFlac == NULL) {
+        printf("  [%s] Failed to open", pPathName);
+        return DRFLAC_ERROR;
+    }
+
+    pDecoded = read_remaining_pcm_frames_s32(pFlac, &decodedCount);
+    if (pDecoded == NULL || decodedCount != sampleCount) {
+        printf("  [%s] Expecting %d PCM frames, but got %d", pPathName, (int)sampleCount, (int)decodedCount);
+        result = DRFLAC_ERROR;
+    } else {
+        /* The s32 output has the samples in the most significant bits. */
+        for (iSample = 0; iSample < sampleCount; iSample += 1) {
+            if (pDecoded[iSample] != (drflac_int32)((drflac_uint32)pSamples[iSample] << (32 - bitsPerSample))) {
+                printf("  [%s] PCM frame %d differs (order %d)", pPathName, (int)iSample, (int)(iSample / 1152) + 1);
+                result = DRFLAC_ERROR;
+                break;
+            }
+        }
+    }
+
+    free(pDecoded);
+    drflac_close(pFlac);
+    return result;
+}
+
+drflac_result test_lpc_stream(const char* pName, drflac_uint32 bitsPerSample, drflac_bool32 use64BitPrediction)
+{
+    drflac_result result = DRFLAC_SUCCESS;
+    drflac_uint8* pData;
+    size_t dataSize;
+    drflac_int32* pSamples;
+    drflac_uint64 sampleCount;
+
+    dr_printf_fixed_with_margin(FILE_NAME_WIDTH, TABLE_MARGIN, "%s", pName);
+
+    pData = generate_lpc_stream(bitsPerSample, use64BitPrediction, &pSamples, &sampleCount, NULL, &dataSize);
+
+    /*
+    Each code path the CPU supports is turned off in turn, widest first, so the same stream goes through every one of them down
+    to the scalar code. These flags are only read by the decoder so flipping them here is safe.
+    */
+    drflac__init_cpu_caps();
+    {
+    #ifndef DRFLAC_NO_CPUID
+        drflac_bool32* pFlags[] = { &drflac__gIsAVX512Supported, &drflac__gIsAVX2Supported, &drflac__gIsSSE41Supported };
+        const char* pFlagNames[] = { "AVX-512", "AVX2", "SSE4.1" };
+    #else
+        drflac_bool32* pFlags[] = { &drflac__gIsNEONSupported };
+        const char* pFlagNames[] = { "NEON" };
+    #endif
+        drflac_bool32 wasSupported[sizeof(pFlags)/sizeof(pFlags[0])];
+        size_t iFlag;
+
+        for (iFlag = 0; iFlag < sizeof(pFlags)/sizeof(pFlags[0]); iFlag += 1) {
+            wasSupported[iFlag] = *pFlags[iFlag];
+        }
+
+        for (iFlag = 0; iFlag < sizeof(pFlags)/sizeof(pFlags[0]) && result == DRFLAC_SUCCESS; iFlag += 1) {
+            if (wasSupported[iFlag]) {
+                result = decode_and_compare_lpc_stream(pData, dataSize, bitsPerSample, pSamples, sampleCount, pFlagNames[iFlag]);
+                *pFlags[iFlag] = DRFLAC_FALSE;
+            }
+        }
+
+        if (result == DRFLAC_SUCCESS) {
+            result = decode_and_compare_lpc_stream(pData, dataSize, bitsPerSample, pSamples, sampleCount, "Scalar");
+        }
+
+        for (iFlag = 0; iFlag < sizeof(pFlags)/sizeof(pFlags[0]); iFlag += 1) {
+            *pFlags[iFlag] = wasSupported[iFlag];
+        }
+    }
+
+    if (result == DRFLAC_SUCCESS) {
+        printf("  Passed\n");
+    } else {
+        printf("\n");
+    }
+
+    free(pSamples);
+    free(pData);
+    return result;
+}
+
+static drflac_result decode_corrupt_stream(const drflac_uint8* pData, size_t dataSize, drflac_bool32 isCRCEnabled, const drflac_int32* pSamples, drflac_uint64 sampleCount, drflac_uint64 corruptFrameStart, drflac_uint64 corruptFrameLength, const char* pPathName)
+{
+    drflac* pFlac;
+    drflac_int32* pDecoded;
+    drflac_uint64 decodedCount;
+    drflac_uint64 expectedCount;
+    drflac_result result = DRFLAC_SUCCESS;
+
+    pFlac = drflac_open_memory(pData, dataSize, NULL);
+    if (pFlac == NULL) {
+        printf("  [%s] Failed to open", pPathName);
+        return DRFLAC_ERROR;
+    }
+
+    if (!drflac_set_crc_verification(pFlac, isCRCEnabled)) {
+        printf("  [%s] Failed to %s CRC verification", pPathName, isCRCEnabled ? "enable" : "disable");
+        drflac_close(pFlac);
+        return DRFLAC_ERROR;
+    }
+
+    /* A frame that fails the CRC is skipped. Otherwise it's decoded as normal, but with the wrong samples. */
+    expectedCount = isCRCEnabled ? sampleCount - corruptFrameLength : sampleCount;
+
+    pDecoded = read_remaining_pcm_frames_s32(pFlac, &decodedCount);
+    if (pDecoded == NULL || decodedCount != expectedCount) {
+        printf("  [%s] Expecting %d PCM frames with CRC verification %s, but got %d", pPathName, (int)expectedCount, isCRCEnabled ? "enabled" : "disabled", (int)decodedCount);
+        result = DRFLAC_ERROR;
+    } else {
+        drflac_uint64 iSample;
+        drflac_bool32 isCorruptFrameDifferent = DRFLAC_FALSE;
+
+        for (iSample = 0; iSample < decodedCount; iSample += 1) {
+            drflac_uint64 iSourceSample = iSample;
+            drflac_int32 expected;
+
+            if (isCRCEnabled && iSample >= corruptFrameStart) {
+                iSourceSample += corruptFrameLength;
+            }
+
+            expected = (drflac_int32)((drflac_uint32)pSamples[iSourceSample] << 16);
+
+            if (!isCRCEnabled && iSourceSample >= corruptFrameStart && iSourceSample < corruptFrameStart + corruptFrameLength) {
+                if (pDecoded[iSample] != expected) {
+                    isCorruptFrameDifferent = DRFLAC_TRUE;
+                }
+            } else if (pDecoded[iSample] != expected) {
+                printf("  [%s] PCM frame %d differs with CRC verification %s", pPathName, (int)iSourceSample, isCRCEnabled ? "enabled" : "disabled");
+                result = DRFLAC_ERROR;
+                break;
+            }
+        }
+
+        if (result == DRFLAC_SUCCESS && !isCRCEnabled && !isCorruptFrameDifferent) {
+            printf("  [%s] Expecting the corrupt frame to be decoded with CRC verification disabled", pPathName);
+            result = DRFLAC_ERROR;
+        }
+    }
+
+    free(pDecoded);
+    drflac_close(pFlac);
+    return result;
+}
+
+drflac_result test_crc(void)
+{
+    /* The frame for order 8. Its header is 8 bytes, then a byte for the subframe header, then 16 bytes of warm up samples. */
+    const drflac_uint32 corruptFrame = 7;
+    const drflac_uint64 blockSize = 1152;
+    drflac_result result = DRFLAC_SUCCESS;
+    drflac_uint8* pData;
+    size_t dataSize;
+    drflac_int32* pSamples;
+    drflac_uint64 sampleCount;
+    size_t frameOffsets[32];
+
+    dr_printf_fixed_with_margin(FILE_NAME_WIDTH, TABLE_MARGIN, "%s", "CRC, corrupt frame");
+
+    /*
+    Flipping the bits of a warm up sample changes every sample in the frame without changing the layout of the bitstream, which means
+    the only thing that can catch it is the CRC-16 of the frame.
+    */
+    pData = generate_lpc_stream(16, DRFLAC_FALSE, &pSamples, &sampleCount, frameOffsets, &dataSize);
+    pData[frameOffsets[corruptFrame] + 10] ^= 0xFF;
+
+    drflac__init_cpu_caps();
+    {
+    #if defined(DRFLAC_SUPPORT_PCLMUL)
+        drflac_bool32* pFlag = &drflac__gIsPCLMULSupported;
+        const char* pFlagName = "PCLMUL";
+    #elif defined(DRFLAC_SUPPORT_PMULL)
+        drflac_bool32* pFlag = &drflac__gIsPMULLSupported;
+        const char* pFlagName = "PMULL";
+    #else
+        drflac_bool32 flag = DRFLAC_FALSE;
+        drflac_bool32* pFlag = &flag;
+        const char* pFlagName = "";
+    #endif
+        drflac_bool32 wasSupported = *pFlag;
+
+        /* The carry-less multiply is tried first, then the table based CRC. Neither exists with DR_FLAC_NO_CRC. */
+    #ifndef DR_FLAC_NO_CRC
+        if (wasSupported) {
+            result = decode_corrupt_stream(pData, dataSize, DRFLAC_TRUE, pSamples, sampleCount, blockSize * corruptFrame, blockSize, pFlagName);
+            *pFlag = DRFLAC_FALSE;
+        }
+
+        if (result == DRFLAC_SUCCESS) {
+            result = decode_corrupt_stream(pData, dataSize, DRFLAC_TRUE, pSamples, sampleCount, blockSize * corruptFrame, blockSize, "Scalar");
+        }
+
+        *pFlag = wasSupported;
+    #else
+        (void)wasSupported;
+        (void)pFlagName;
+    #endif
+
+        if (result == DRFLAC_SUCCESS) {
+            result = decode_corrupt_stream(pData, dataSize, DRFLAC_FALSE, pSamples, sampleCount, blockSize * corruptFrame, blockSize, "No CRC");
+        }
+    }
+
+    if (result == DRFLAC_SUCCESS) {
+        printf("  Passed\n");
+    } else {
+        printf("\n");
+    }
+
+    free(pSamples);
+    free(pData);
+    return result;
+}
+
+drflac_result test_generated_seek_index(void)
+{
+    drflac_result result;
+    drflac_uint8* pData;
+    size_t dataSize;
+    drflac_int32* pSamples;
+    drflac_uint64 sampleCount;
+    drflac_uint64 iSample;
+
+    dr_printf_fixed_with_margin(FILE_NAME_WIDTH, TABLE_MARGIN, "%s", "Seek index");
+
+    pData = generate_lpc_stream(16, DRFLAC_FALSE, &pSamples, &sampleCount, NULL, &dataSize);
+
+    /* The stream is mono so the reference is just the samples shifted up to 32 bits. */
+    for (iSample = 0; iSample < sampleCount; iSample += 1) {
+        pSamples[iSample] = (drflac_int32)((drflac_uint32)pSamples[iSample] << 16);
+    }
+
+    result = test_seek_index(pData, dataSize, pSamples, sampleCount);
+    if (result == DRFLAC_SUCCESS) {
+        printf("  Passed\n");
+    } else {
+        printf("\n");
+    }
+
+    free(pSamples);
+    free(pData);
+    return result;
+}
+
+drflac_result test_lpc_streams(void)
+{
+    drflac_bool32 hasError = DRFLAC_FALSE;
+
+    dr_seed(1234);
+
+    dr_printf_fixed(FILE_NAME_WIDTH, "%s", "Generated");
+    dr_printf_fixed_with_margin(NUMBER_WIDTH, TABLE_MARGIN, "RESULT");
+    printf("\n");
+
+    if (test_lpc_stream("LPC, 16-bit, 32-bit prediction", 16, DRFLAC_FALSE) != DRFLAC_SUCCESS) { hasError = DRFLAC_TRUE; }
+    if (test_lpc_stream("LPC, 16-bit, 64-bit prediction", 16, DRFLAC_TRUE ) != DRFLAC_SUCCESS) { hasError = DRFLAC_TRUE; }
+    if (test_lpc_stream("LPC, 24-bit, 32-bit prediction", 24, DRFLAC_FALSE) != DRFLAC_SUCCESS) { hasError = DRFLAC_TRUE; }
+    if (test_lpc_stream("LPC, 24-bit, 64-bit prediction", 24, DRFLAC_TRUE ) != DRFLAC_SUCCESS) { hasError = DRFLAC_TRUE; }
+    if (test_crc() != DRFLAC_SUCCESS) { hasError = DRFLAC_TRUE; }
+    if (test_generated_seek_index() != DRFLAC_SUCCESS) { hasError = DRFLAC_TRUE; }
+
+    return hasError ? DRFLAC_ERROR : DRFLAC_SUCCESS;
+}
+
+drflac_result test_directory(const char* pDirectoryPath)
+{
+    dr_file_iterator iteratorState;
+    dr_file_iterator* pFile;
+    drflac_bool32 hasError = DRFLAC_FALSE;
+
+    dr_printf_fixed(FILE_NAME_WIDTH, "%s", pDirectoryPath);
+    dr_printf_fixed_with_margin(NUMBER_WIDTH, TABLE_MARGIN, "RESULT");
+    printf("\n");
+
+    pFile = dr_file_iterator_begin(pDirectoryPath, &iteratorState);
+    if (pFile == NULL) {
+        printf("Failed to open directory \"%s\"\n", pDirectoryPath);
+        return DRFLAC_ERROR;
+    }
+
+    while (pFile != NULL) {
+        /* Skip directories for now, but we may want to look at doing recursive file iteration. */
+        if (!pFile->isDirectory && (dr_extension_equal(pFile->absolutePath, "flac") || dr_extension_equal(pFile->absolutePath, "oga") || dr_extension_equal(pFile->absolutePath, "ogg"))) {
+            if (test_file(pFile->absolutePath) != DRFLAC_SUCCESS) {
+                hasError = DRFLAC_TRUE;
+            }
+        }
+
+        pFile = dr_file_iterator_next(pFile);
+    }
+
+    return hasError ? DRFLAC_ERROR : DRFLAC_SUCCESS;
+}
+
+int main(int argc, char** argv)
+{
+    const char* pSourceDir = DEFAULT_SOURCE_DIR;
+    drflac_bool32 hasError = DRFLAC_FALSE;
+
+    if (argc >= 2) {
+        pSourceDir = argv[1];
+    }
+
+    if (test_lpc_streams() != DRFLAC_SUCCESS) {
+        hasError = DRFLAC_TRUE;
+    }
+
+    printf("\n");
+
+    if (test_directory(pSourceDir) != DRFLAC_SUCCESS) {
+        hasError = DRFLAC_TRUE;
+    }
+
+    return hasError ? 1 : 0;
+}
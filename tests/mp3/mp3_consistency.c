@@ -0,0 +1,267 @@
+/*
+This test checks that the different ways of decoding the same stream are consistent with each other.
+
+The multithreaded `_mt` APIs split the stream into segments which are decoded on their own threads. The output of these needs to be
+identical to a single threaded decode, which is what this checks with a few different thread counts.
+
+The low level decoder can use scratch memory supplied by the caller with drmp3dec_decode_frame_with_scratch(). One instance of the
+scratch memory is shared between two decoders that are used in turns on different MP3 frames, the output of which needs to be
+identical to a decoder using its own embedded scratch memory.
+
+Exact seeking needs to land on the exact PCM frame, even after an approximate seek has left the decoder at an estimated position.
+*/
+#include "mp3_common.c"
+
+#define FILE_NAME_WIDTH 40
+#define NUMBER_WIDTH    10
+#define TABLE_MARGIN    2
+
+int test_mt(const char* pFilePath, const void* pData, size_t dataSize)
+{
+    int result = 0;
+    drmp3_uint32 threadCounts[] = {0, 2, 3, 8};
+    drmp3_uint32 iThreadCount;
+    drmp3_config config;
+    drmp3_uint64 pcmFrameCountST;
+    drmp3_uint64 pcmFrameCountMT;
+    drmp3_int16* pS16;
+    float* pF32;
+
+    pS16 = drmp3_open_memory_and_read_pcm_frames_s16(pData, dataSize, &config, &pcmFrameCountST, NULL);
+    pF32 = drmp3_open_memory_and_read_pcm_frames_f32(pData, dataSize, &config, &pcmFrameCountST, NULL);
+    if (pS16 == NULL || pF32 == NULL) {
+        drmp3_free(pS16, NULL);
+        drmp3_free(pF32, NULL);
+        printf("[MT] Single threaded decode failed\n");
+        return 1;
+    }
+
+    for (iThreadCount = 0; iThreadCount < DRMP3_COUNTOF(threadCounts) && result == 0; iThreadCount += 1) {
+        drmp3_uint32 threadCount = threadCounts[iThreadCount];
+        int iVariant;
+
+        for (iVariant = 0; iVariant < 4 && result == 0; iVariant += 1) {
+            void* pMT;
+            const void* pST;
+            size_t bytesPerSample;
+
+            switch (iVariant) {
+                case 0:  pMT = drmp3_open_memory_and_read_pcm_frames_s16_mt(pData, dataSize, threadCount, &config, &pcmFrameCountMT, NULL); pST = pS16; bytesPerSample = sizeof(drmp3_int16); break;
+                case 1:  pMT = drmp3_open_memory_and_read_pcm_frames_f32_mt(pData, dataSize, threadCount, &config, &pcmFrameCountMT, NULL); pST = pF32; bytesPerSample = sizeof(float);       break;
+                case 2:  pMT = drmp3_open_file_and_read_pcm_frames_s16_mt(pFilePath, threadCount, &config, &pcmFrameCountMT, NULL);          pST = pS16; bytesPerSample = sizeof(drmp3_int16); break;
+                default: pMT = drmp3_open_file_and_read_pcm_frames_f32_mt(pFilePath, threadCount, &config, &pcmFrameCountMT, NULL);          pST = pF32; bytesPerSample = sizeof(float);       break;
+            }
+
+            if (pMT == NULL) {
+                printf("[MT] Decode failed (variant %d, %d threads)\n", iVariant, (int)threadCount);
+                result = 1;
+                break;
+            }
+
+            if (pcmFrameCountMT != pcmFrameCountST || memcmp(pMT, pST, (size_t)(pcmFrameCountST * config.channels * bytesPerSample)) != 0) {
+                printf("[MT] Output differs from single threaded decode (variant %d, %d threads)\n", iVariant, (int)threadCount);
+                result = 1;
+            }
+
+            drmp3_free(pMT, NULL);
+        }
+    }
+
+    drmp3_free(pS16, NULL);
+    drmp3_free(pF32, NULL);
+    return result;
+}
+
+int test_shared_scratch(const void* pData, size_t dataSize)
+{
+    /*
+    Decoder A uses its embedded scratch memory. Decoders B and C share the same scratch memory and are used in turns, with C running
+    one MP3 frame behind B. If anything carried over in the scratch memory from one call to the next, C would pick up what B left
+    behind and its output would not match what A produced for the same MP3 frame.
+    */
+    drmp3dec decoderA;
+    drmp3dec decoderB;
+    drmp3dec decoderC;
+    drmp3dec_scratch scratch;
+    const drmp3_uint8* pBytes = (const drmp3_uint8*)pData;
+    float pcmA[2][DRMP3_MAX_SAMPLES_PER_FRAME];     /* <-- Big enough for either format. The previous MP3 frame is kept for comparing against C. */
+    drmp3dec_frame_info infoA[2];
+    int pcmFrameCountA[2];
+    size_t posA = 0;
+    size_t posB = 0;
+    size_t posC = 0;
+    size_t bytesPerSample = DRMP3_FORMAT_SAMPLE_SIZE(DRMP3_DEFAULT_FORMAT);
+    int iFrame;
+
+    drmp3dec_init(&decoderA);
+    drmp3dec_init(&decoderB);
+    drmp3dec_init(&decoderC);
+
+    for (iFrame = 0; ; iFrame += 1) {
+        float pcmB[DRMP3_MAX_SAMPLES_PER_FRAME];
+        float pcmC[DRMP3_MAX_SAMPLES_PER_FRAME];
+        drmp3dec_frame_info infoB;
+        drmp3dec_frame_info infoC;
+        int pcmFrameCountB;
+        int pcmFrameCountC;
+        int iCurr = iFrame & 1;
+        int iPrev = iCurr ^ 1;
+
+        pcmFrameCountA[iCurr] = drmp3dec_decode_frame(&decoderA, pBytes + posA, (int)(dataSize - posA), pcmA[iCurr], &infoA[iCurr]);
+        pcmFrameCountB        = drmp3dec_decode_frame_with_scratch(&decoderB, &scratch, pBytes + posB, (int)(dataSize - posB), pcmB, &infoB);
+
+        if (pcmFrameCountA[iCurr] != pcmFrameCountB || infoA[iCurr].frame_bytes != infoB.frame_bytes || memcmp(pcmA[iCurr], pcmB, pcmFrameCountB * infoB.channels * bytesPerSample) != 0) {
+            printf("[Scratch] MP3 frames differ @ %d\n", (int)posA);
+            return 1;
+        }
+
+        if (iFrame > 0) {
+            pcmFrameCountC = drmp3dec_decode_frame_with_scratch(&decoderC, &scratch, pBytes + posC, (int)(dataSize - posC), pcmC, &infoC);
+
+            if (pcmFrameCountA[iPrev] != pcmFrameCountC || infoA[iPrev].frame_bytes != infoC.frame_bytes || memcmp(pcmA[iPrev], pcmC, pcmFrameCountC * infoC.channels * bytesPerSample) != 0) {
+                printf("[Scratch] MP3 frames differ when sharing scratch memory @ %d\n", (int)posC);
+                return 1;
+            }
+
+            posC += infoC.frame_bytes;
+        }
+
+        if (infoA[iCurr].frame_bytes == 0) {
+            break;
+        }
+
+        posA += infoA[iCurr].frame_bytes;
+        posB += infoB.frame_bytes;
+    }
+
+    return 0;
+}
+
+int test_exact_seek(const void* pData, size_t dataSize)
+{
+    int result = 0;
+    drmp3 mp3;
+    drmp3_config config;
+    drmp3_uint64 referencePCMFrameCount;
+    float* pReference;
+    int iIteration;
+
+    pReference = drmp3_open_memory_and_read_pcm_frames_f32(pData, dataSize, &config, &referencePCMFrameCount, NULL);
+    if (pReference == NULL) {
+        printf("[Seek] Failed to decode reference\n");
+        return 1;
+    }
+
+    if (!drmp3_init_memory(&mp3, pData, dataSize, NULL)) {
+        drmp3_free(pReference, NULL);
+        printf("[Seek] Failed to init MP3 decoder\n");
+        return 1;
+    }
+
+    dr_seed(1234);
+
+    for (iIteration = 0; iIteration < 20 && result == 0; iIteration += 1) {
+        float pcmFrames[4096];
+        drmp3_uint64 targetPCMFrame = dr_rand_range_u64(0, referencePCMFrameCount);
+        drmp3_uint64 pcmFramesToRead = DRMP3_MIN(DRMP3_COUNTOF(pcmFrames) / mp3.channels, referencePCMFrameCount - targetPCMFrame);
+        drmp3_uint64 pcmFramesRead;
+
+        /* Every other iteration does an approximate seek first so the exact seek starts from an estimated position. */
+        if ((iIteration & 1) != 0) {
+            drmp3_seek_to_pcm_frame_approximate(&mp3, dr_rand_range_u64(0, referencePCMFrameCount));
+        }
+
+        if (!drmp3_seek_to_pcm_frame(&mp3, targetPCMFrame)) {
+            printf("[Seek] Failed to seek to PCM frame @ %d\n", (int)targetPCMFrame);
+            result = 1;
+            break;
+        }
+
+        pcmFramesRead = drmp3_read_pcm_frames_f32(&mp3, pcmFramesToRead, pcmFrames);
+        if (pcmFramesRead != pcmFramesToRead || memcmp(pcmFrames, pReference + (targetPCMFrame * mp3.channels), (size_t)(pcmFramesRead * mp3.channels * sizeof(float))) != 0) {
+            printf("[Seek] Samples differ after seeking to PCM frame @ %d\n", (int)targetPCMFrame);
+            result = 1;
+        }
+    }
+
+    drmp3_uninit(&mp3);
+    drmp3_free(pReference, NULL);
+    return result;
+}
+
+int test_file(const char* pFilePath)
+{
+    int result = 0;
+    size_t dataSize;
+    void* pData;
+
+    dr_printf_fixed_with_margin(FILE_NAME_WIDTH, TABLE_MARGIN, "%s", dr_path_file_name(pFilePath));
+
+    pData = dr_open_and_read_file(pFilePath, &dataSize);
+    if (pData == NULL) {
+        printf("Failed to open file \"%s\"\n", pFilePath);
+        return 1;
+    }
+
+    if (result == 0) {
+        result = test_mt(pFilePath, pData, dataSize);
+    }
+    if (result == 0) {
+        result = test_shared_scratch(pData, dataSize);
+    }
+    if (result == 0) {
+        result = test_exact_seek(pData, dataSize);
+    }
+
+    if (result == 0) {
+        printf("  OK\n");
+    }
+
+    free(pData);
+    return result;
+}
+
+int test_directory(const char* pDirectoryPath)
+{
+    dr_file_iterator iteratorState;
+    dr_file_iterator* pFile;
+    drmp3_bool32 hasError = DRMP3_FALSE;
+
+    dr_printf_fixed(FILE_NAME_WIDTH, "%s", pDirectoryPath);
+    dr_printf_fixed_with_margin(NUMBER_WIDTH, TABLE_MARGIN, "RESULT");
+    printf("\n");
+
+    pFile = dr_file_iterator_begin(pDirectoryPath, &iteratorState);
+    if (pFile == NULL) {
+        printf("Failed to open directory \"%s\"\n", pDirectoryPath);
+        return 1;
+    }
+
+    while (pFile != NULL) {
+        /* Skip directories for now, but we may want to look at doing recursive file iteration. */
+        if (!pFile->isDirectory) {
+            if (test_file(pFile->absolutePath) != 0) {
+                hasError = DRMP3_TRUE;
+            }
+        }
+
+        pFile = dr_file_iterator_next(pFile);
+    }
+
+    if (hasError) {
+        return 1;
+    } else {
+        return 0;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    const char* pTestsFolder = "tests/testvectors/mp3/tests";
+
+    if (argc >= 2) {
+        pTestsFolder = argv[1];
+    }
+
+    return test_directory(pTestsFolder);
+}
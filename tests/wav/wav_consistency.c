@@ -0,0 +1,1049 @@
+/*
+This test checks that the different ways of getting audio out of dr_wav are consistent with each other. The streams are generated
+in memory so, unlike the other WAV tests, this does not need libsndfile or any test vectors.
+
+  - Seeking in MS-ADPCM and IMA-ADPCM streams against a sequential decode.
+  - drwav_map_pcm_frames() and the s16/f32/s32 conversions of memory and memory mapped decoders against a decoder that can't map.
+  - The SIMD sample format conversions against the scalar code used when DR_WAV_NO_SIMD is defined.
+*/
+#define DR_WAV_IMPLEMENTATION
+#include "../../dr_wav.h"
+
+#include "../common/dr_common.c"
+
+#define TABLE_WIDTH     40
+#define TABLE_MARGIN    2
+
+/* A growable byte buffer for building wave files in memory. */
+typedef struct
+{
+    drwav_uint8* pData;
+    size_t size;
+    size_t capacity;
+} wav_builder;
+
+static void wav_builder_write(wav_builder* pBuilder, const void* pData, size_t size)
+{
+    if (pBuilder->size + size > pBuilder->capacity) {
+        size_t newCapacity = (pBuilder->capacity == 0) ? 4096 : pBuilder->capacity * 2;
+        while (newCapacity < pBuilder->size + size) {
+            newCapacity *= 2;
+        }
+
+        pBuilder->pData    = (drwav_uint8*)realloc(pBuilder->pData, newCapacity);
+        pBuilder->capacity = newCapacity;
+    }
+
+    memcpy(pBuilder->pData + pBuilder->size, pData, size);
+    pBuilder->size += size;
+}
+
+static void wav_builder_write_u16(wav_builder* pBuilder, drwav_uint16 value)
+{
+    drwav_uint8 bytes[2];
+    bytes[0] = (drwav_uint8)(value >> 0);
+    bytes[1] = (drwav_uint8)(value >> 8);
+    wav_builder_write(pBuilder, bytes, sizeof(bytes));
+}
+
+static void wav_builder_write_u32(wav_builder* pBuilder, drwav_uint32 value)
+{
+    drwav_uint8 bytes[4];
+    bytes[0] = (drwav_uint8)(value >>  0);
+    bytes[1] = (drwav_uint8)(value >>  8);
+    bytes[2] = (drwav_uint8)(value >> 16);
+    bytes[3] = (drwav_uint8)(value >> 24);
+    wav_builder_write(pBuilder, bytes, sizeof(bytes));
+}
+
+/*
+Builds a RIFF/WAVE file around the given sample data. The fmt extension, if any, is written after cbSize. A JUNK chunk of junkSize
+bytes is placed before the data chunk if junkSize is not 0 which can be used to move the sample data around. The returned buffer
+needs to be freed with free().
+*/
+static drwav_uint8* build_wav(drwav_uint16 formatTag, drwav_uint16 channels, drwav_uint16 bitsPerSample, drwav_uint16 blockAlign, const drwav_uint8* pExtension, drwav_uint16 extensionSize, drwav_uint32 junkSize, const drwav_uint8* pSampleData, size_t sampleDataSize, size_t* pFileSize)
+{
+    wav_builder builder;
+    drwav_uint32 sampleRate = 44100;
+
+    DRWAV_ZERO_OBJECT(&builder);
+
+    wav_builder_write(&builder, "RIFF", 4);
+    wav_builder_write_u32(&builder, 0);  /* Filled in at the end. */
+    wav_builder_write(&builder, "WAVE", 4);
+
+    wav_builder_write(&builder, "fmt ", 4);
+    wav_builder_write_u32(&builder, 18 + extensionSize);
+    wav_builder_write_u16(&builder, formatTag);
+    wav_builder_write_u16(&builder, channels);
+    wav_builder_write_u32(&builder, sampleRate);
+    wav_builder_write_u32(&builder, sampleRate * blockAlign);
+    wav_builder_write_u16(&builder, blockAlign);
+    wav_builder_write_u16(&builder, bitsPerSample);
+    wav_builder_write_u16(&builder, extensionSize);
+    if (extensionSize > 0) {
+        wav_builder_write(&builder, pExtension, extensionSize);
+    }
+
+    if (junkSize > 0) {
+        drwav_uint32 iByte;
+
+        wav_builder_write(&builder, "JUNK", 4);
+        wav_builder_write_u32(&builder, junkSize);
+        for (iByte = 0; iByte < junkSize + (junkSize & 1); iByte += 1) {
+            wav_builder_write(&builder, "", 1);
+        }
+    }
+
+    wav_builder_write(&builder, "data", 4);
+    wav_builder_write_u32(&builder, (drwav_uint32)sampleDataSize);
+    wav_builder_write(&builder, pSampleData, sampleDataSize);
+    if ((sampleDataSize & 1) != 0) {
+        wav_builder_write(&builder, "", 1);  /* Padding. */
+    }
+
+    builder.pData[4] = (drwav_uint8)((builder.size - 8) >>  0);
+    builder.pData[5] = (drwav_uint8)((builder.size - 8) >>  8);
+    builder.pData[6] = (drwav_uint8)((builder.size - 8) >> 16);
+    builder.pData[7] = (drwav_uint8)((builder.size - 8) >> 24);
+
+    *pFileSize = builder.size;
+    return builder.pData;
+}
+
+/* Fills a buffer with random nibbles, with a valid header at the start of each block. The last block can be partial. */
+static drwav_uint8* generate_adpcm_data(drwav_uint16 formatTag, drwav_uint16 channels, drwav_uint16 blockAlign, drwav_uint32 blockCount, drwav_uint32 partialBlockSize, size_t* pDataSize)
+{
+    size_t dataSize = (size_t)blockAlign * blockCount + partialBlockSize;
+    drwav_uint8* pData = (drwav_uint8*)malloc(dataSize);
+    size_t iByte;
+    size_t blockOffset;
+    drwav_uint16 iChannel;
+
+    for (iByte = 0; iByte < dataSize; iByte += 1) {
+        pData[iByte] = (drwav_uint8)dr_rand_range_s32(0, 255);
+    }
+
+    for (blockOffset = 0; blockOffset < dataSize; blockOffset += blockAlign) {
+        drwav_uint8* pHeader = pData + blockOffset;
+
+        if (formatTag == DR_WAVE_FORMAT_ADPCM) {
+            /* Predictors, then deltas, then two samples per channel. The predictor needs to index into the coefficient table. */
+            if (blockOffset + 7*channels > dataSize) {
+                break;
+            }
+
+            for (iChannel = 0; iChannel < channels; iChannel += 1) {
+                drwav_uint16 delta = (drwav_uint16)dr_rand_range_s32(16, 2048);
+                pHeader[iChannel] = (drwav_uint8)dr_rand_range_s32(0, 6);
+                pHeader[channels + iChannel*2 + 0] = (drwav_uint8)(delta >> 0);
+                pHeader[channels + iChannel*2 + 1] = (drwav_uint8)(delta >> 8);
+            }
+        } else {
+            /* A predictor, a step index and a reserved byte per channel. The step index needs to index into the step table. */
+            if (blockOffset + 4*channels > dataSize) {
+                break;
+            }
+
+            for (iChannel = 0; iChannel < channels; iChannel += 1) {
+                pHeader[iChannel*4 + 2] = (drwav_uint8)dr_rand_range_s32(0, 88);
+                pHeader[iChannel*4 + 3] = 0;
+            }
+        }
+    }
+
+    *pDataSize = dataSize;
+    return pData;
+}
+
+static drwav_uint8* build_adpcm_wav(drwav_uint16 formatTag, drwav_uint16 channels, drwav_uint16 blockAlign, drwav_uint32 blockCount, drwav_uint32 partialBlockSize, size_t* pFileSize)
+{
+    drwav_uint8 extension[32];
+    drwav_uint16 extensionSize;
+    drwav_uint8* pSampleData;
+    size_t sampleDataSize;
+    drwav_uint8* pFileData;
+
+    DRWAV_ZERO_MEMORY(extension, sizeof(extension));
+
+    if (formatTag == DR_WAVE_FORMAT_ADPCM) {
+        /* wSamplesPerBlock, wNumCoef and the standard coefficient table. dr_wav has the table built in, but real files have it. */
+        static const drwav_int16 coefficients[14] = { 256, 0, 512, -256, 0, 0, 192, 64, 240, 0, 460, -208, 392, -232 };
+        drwav_uint16 samplesPerBlock = (drwav_uint16)(2 + ((blockAlign - 7*channels) * 2) / channels);
+        int iCoefficient;
+
+        extension[0] = (drwav_uint8)(samplesPerBlock >> 0);
+        extension[1] = (drwav_uint8)(samplesPerBlock >> 8);
+        extension[2] = 7;
+        for (iCoefficient = 0; iCoefficient < 14; iCoefficient += 1) {
+            extension[4 + iCoefficient*2 + 0] = (drwav_uint8)((drwav_uint16)coefficients[iCoefficient] >> 0);
+            extension[4 + iCoefficient*2 + 1] = (drwav_uint8)((drwav_uint16)coefficients[iCoefficient] >> 8);
+        }
+
+        extensionSize = 32;
+    } else {
+        drwav_uint16 samplesPerBlock = (drwav_uint16)(1 + ((blockAlign - 4*channels) * 2) / channels);
+
+        extension[0] = (drwav_uint8)(samplesPerBlock >> 0);
+        extension[1] = (drwav_uint8)(samplesPerBlock >> 8);
+        extensionSize = 2;
+    }
+
+    pSampleData = generate_adpcm_data(formatTag, channels, blockAlign, blockCount, partialBlockSize, &sampleDataSize);
+    pFileData   = build_wav(formatTag, channels, 4, blockAlign, extension, extensionSize, 0, pSampleData, sampleDataSize, pFileSize);
+
+    free(pSampleData);
+    return pFileData;
+}
+
+/* Decodes the whole stream in small chunks. The returned buffer needs to be freed with free(). */
+static drwav_int16* read_all_pcm_frames_s16(drwav* pWav, drwav_uint64* pFrameCount)
+{
+    drwav_int16* pFrames = (drwav_int16*)malloc((size_t)(pWav->totalPCMFrameCount + 1) * pWav->channels * sizeof(drwav_int16));
+    drwav_uint64 frameCount = 0;
+
+    for (;;) {
+        drwav_uint64 framesToRead = (drwav_uint64)dr_rand_range_s32(1, 300);
+        drwav_uint64 framesRead;
+
+        if (framesToRead > pWav->totalPCMFrameCount - frameCount) {
+            framesToRead = pWav->totalPCMFrameCount - frameCount;
+        }
+
+        if (framesToRead == 0) {
+            break;
+        }
+
+        framesRead = drwav_read_pcm_frames_s16(pWav, framesToRead, pFrames + (frameCount * pWav->channels));
+        if (framesRead == 0) {
+            break;
+        }
+
+        frameCount += framesRead;
+    }
+
+    *pFrameCount = frameCount;
+    return pFrames;
+}
+
+static drwav_bool32 seek_and_compare_s16(drwav* pWav, drwav_uint64 targetFrameIndex, const drwav_int16* pReference, drwav_uint64 referenceFrameCount)
+{
+    drwav_int16 frames[64 * 2];
+    drwav_uint64 framesToRead = drwav_countof(frames) / pWav->channels;
+    drwav_uint64 framesRead;
+
+    if (framesToRead > referenceFrameCount - targetFrameIndex) {
+        framesToRead = referenceFrameCount - targetFrameIndex;
+    }
+
+    if (!drwav_seek_to_pcm_frame(pWav, targetFrameIndex)) {
+        printf("  Failed to seek to PCM frame %d", (int)targetFrameIndex);
+        return DRWAV_FALSE;
+    }
+
+    framesRead = (framesToRead > 0) ? drwav_read_pcm_frames_s16(pWav, framesToRead, frames) : 0;
+    if (framesRead != framesToRead) {
+        printf("  Expecting %d PCM frames after seeking to %d, but got %d", (int)framesToRead, (int)targetFrameIndex, (int)framesRead);
+        return DRWAV_FALSE;
+    }
+
+    if (memcmp(frames, pReference + (targetFrameIndex * pWav->channels), (size_t)(framesRead * pWav->channels * sizeof(drwav_int16))) != 0) {
+        printf("  PCM frames differ after seeking to %d", (int)targetFrameIndex);
+        return DRWAV_FALSE;
+    }
+
+    return DRWAV_TRUE;
+}
+
+drwav_result test_adpcm_seek_case(const char* pName, drwav_uint16 formatTag, drwav_uint16 channels, drwav_uint16 blockAlign, drwav_uint32 blockCount, drwav_uint32 partialBlockSize)
+{
+    drwav_result result = DRWAV_SUCCESS;
+    drwav_uint8* pFileData;
+    size_t fileSize;
+    drwav wav;
+    drwav_int16* pReference;
+    drwav_uint64 referenceFrameCount;
+    drwav_uint64 framesPerBlock;
+    drwav_uint64 iBlock;
+    int iSeek;
+
+    dr_printf_fixed_with_margin(TABLE_WIDTH, TABLE_MARGIN, "%s", pName);
+
+    pFileData = build_adpcm_wav(formatTag, channels, blockAlign, blockCount, partialBlockSize, &fileSize);
+
+    if (!drwav_init_memory(&wav, pFileData, fileSize, NULL)) {
+        free(pFileData);
+        printf("  Failed to open\n");
+        return DRWAV_ERROR;
+    }
+
+    pReference = read_all_pcm_frames_s16(&wav, &referenceFrameCount);
+    if (referenceFrameCount == 0) {
+        printf("  Nothing decoded\n");
+        result = DRWAV_ERROR;
+    }
+
+    /*
+    Every block boundary, and the frames either side of it, is visited going forward and then going backward. This covers jumping
+    between blocks, staying inside the current block and the trailing partial block.
+    */
+    framesPerBlock = drwav__adpcm_frames_per_block(&wav);
+    if (framesPerBlock > 0) {
+        for (iBlock = 0; iBlock * framesPerBlock <= referenceFrameCount && result == DRWAV_SUCCESS; iBlock += 1) {
+            drwav_uint64 blockStart = iBlock * framesPerBlock;
+
+            if ((blockStart > 0 && !seek_and_compare_s16(&wav, blockStart - 1, pReference, referenceFrameCount)) ||
+                                   !seek_and_compare_s16(&wav, blockStart,     pReference, referenceFrameCount)  ||
+                (blockStart + 1 < referenceFrameCount && !seek_and_compare_s16(&wav, blockStart + 1, pReference, referenceFrameCount))) {
+                result = DRWAV_ERROR;
+            }
+        }
+
+        for (iBlock = referenceFrameCount / framesPerBlock + 1; iBlock > 0 && result == DRWAV_SUCCESS; iBlock -= 1) {
+            drwav_uint64 blockStart = (iBlock - 1) * framesPerBlock;
+
+            if (blockStart + framesPerBlock/2 < referenceFrameCount && !seek_and_compare_s16(&wav, blockStart + framesPerBlock/2, pReference, referenceFrameCount)) {
+                result = DRWAV_ERROR;
+            }
+            if (blockStart < referenceFrameCount && !seek_and_compare_s16(&wav, blockStart, pReference, referenceFrameCount)) {
+                result = DRWAV_ERROR;
+            }
+        }
+    }
+
+    /* Random seeks. These are the only ones done when the stream falls back to decoding from the start. */
+    for (iSeek = 0; iSeek < 100 && result == DRWAV_SUCCESS; iSeek += 1) {
+        if (!seek_and_compare_s16(&wav, dr_rand_range_u64(0, referenceFrameCount), pReference, referenceFrameCount)) {
+            result = DRWAV_ERROR;
+        }
+    }
+
+    /* The end of the stream. */
+    if (result == DRWAV_SUCCESS && !seek_and_compare_s16(&wav, referenceFrameCount, pReference, referenceFrameCount)) {
+        result = DRWAV_ERROR;
+    }
+
+    if (result == DRWAV_SUCCESS) {
+        printf("  Passed\n");
+    } else {
+        printf("\n");
+    }
+
+    free(pReference);
+    drwav_uninit(&wav);
+    free(pFileData);
+    return result;
+}
+
+drwav_result test_adpcm_seek(void)
+{
+    drwav_result result = DRWAV_SUCCESS;
+    drwav_uint8* pFileData;
+    size_t fileSize;
+    drwav wav;
+
+    /* Whole blocks, then a trailing partial block, for mono and stereo. */
+    if (test_adpcm_seek_case("MS-ADPCM mono",                   DR_WAVE_FORMAT_ADPCM,     1, 256,  40,   0) != DRWAV_SUCCESS) { result = DRWAV_ERROR; }
+    if (test_adpcm_seek_case("MS-ADPCM mono, partial block",    DR_WAVE_FORMAT_ADPCM,     1, 256,  40, 101) != DRWAV_SUCCESS) { result = DRWAV_ERROR; }
+    if (test_adpcm_seek_case("MS-ADPCM stereo",                 DR_WAVE_FORMAT_ADPCM,     2, 512,  40,   0) != DRWAV_SUCCESS) { result = DRWAV_ERROR; }
+    if (test_adpcm_seek_case("MS-ADPCM stereo, partial block",  DR_WAVE_FORMAT_ADPCM,     2, 512,  40, 300) != DRWAV_SUCCESS) { result = DRWAV_ERROR; }
+    if (test_adpcm_seek_case("IMA-ADPCM mono",                  DR_WAVE_FORMAT_DVI_ADPCM, 1, 256,  40,   0) != DRWAV_SUCCESS) { result = DRWAV_ERROR; }
+    if (test_adpcm_seek_case("IMA-ADPCM mono, partial block",   DR_WAVE_FORMAT_DVI_ADPCM, 1, 256,  40, 100) != DRWAV_SUCCESS) { result = DRWAV_ERROR; }
+    if (test_adpcm_seek_case("IMA-ADPCM stereo",                DR_WAVE_FORMAT_DVI_ADPCM, 2, 1024, 40,   0) != DRWAV_SUCCESS) { result = DRWAV_ERROR; }
+    if (test_adpcm_seek_case("IMA-ADPCM stereo, partial block", DR_WAVE_FORMAT_DVI_ADPCM, 2, 1024, 40, 264) != DRWAV_SUCCESS) { result = DRWAV_ERROR; }
+
+    /* A block size that isn't a whole number of 4 byte groups per channel can't be jumped around in, so this decodes from the start. */
+    if (test_adpcm_seek_case("IMA-ADPCM mono, fallback",        DR_WAVE_FORMAT_DVI_ADPCM, 1, 258,  40,   0) != DRWAV_SUCCESS) { result = DRWAV_ERROR; }
+
+    /* ADPCM with more than 2 channels also can't be jumped around in, but it's rejected outright when opened so it never gets that far. */
+    dr_printf_fixed_with_margin(TABLE_WIDTH, TABLE_MARGIN, "%s", "ADPCM with 3 channels");
+    pFileData = build_adpcm_wav(DR_WAVE_FORMAT_DVI_ADPCM, 3, 384, 4, 0, &fileSize);
+    if (drwav_init_memory(&wav, pFileData, fileSize, NULL)) {
+        drwav_uninit(&wav);
+        printf("  Expecting the file to be rejected\n");
+        result = DRWAV_ERROR;
+    } else {
+        printf("  Passed\n");
+    }
+    free(pFileData);
+
+    return result;
+}
+
+/* A read-only stream over a buffer. Since this doesn't go through drwav_init_memory() the decoder can't map anything. */
+typedef struct
+{
+    const drwav_uint8* pData;
+    size_t dataSize;
+    size_t cursor;
+} buffer_stream;
+
+static size_t buffer_stream_read(void* pUserData, void* pBufferOut, size_t bytesToRead)
+{
+    buffer_stream* pStream = (buffer_stream*)pUserData;
+
+    if (bytesToRead > pStream->dataSize - pStream->cursor) {
+        bytesToRead = pStream->dataSize - pStream->cursor;
+    }
+
+    memcpy(pBufferOut, pStream->pData + pStream->cursor, bytesToRead);
+    pStream->cursor += bytesToRead;
+
+    return bytesToRead;
+}
+
+static drwav_bool32 buffer_stream_seek(void* pUserData, int offset, drwav_seek_origin origin)
+{
+    buffer_stream* pStream = (buffer_stream*)pUserData;
+    drwav_int64 newCursor;
+
+    if (origin == DRWAV_SEEK_SET) {
+        newCursor = offset;
+    } else if (origin == DRWAV_SEEK_CUR) {
+        newCursor = (drwav_int64)pStream->cursor + offset;
+    } else {
+        newCursor = (drwav_int64)pStream->dataSize + offset;
+    }
+
+    if (newCursor < 0 || newCursor > (drwav_int64)pStream->dataSize) {
+        return DRWAV_FALSE;
+    }
+
+    pStream->cursor = (size_t)newCursor;
+    return DRWAV_TRUE;
+}
+
+static drwav_bool32 buffer_stream_tell(void* pUserData, drwav_int64* pCursor)
+{
+    *pCursor = (drwav_int64)((buffer_stream*)pUserData)->cursor;
+    return DRWAV_TRUE;
+}
+
+/* The output of each of the read functions from a decoder that can't map. */
+typedef struct
+{
+    drwav_uint64 frameCount;
+    drwav_uint32 bytesPerFrame;
+    drwav_uint32 channels;
+    drwav_uint8* pRaw;
+    drwav_int16* pS16;
+    float* pF32;
+    drwav_int32* pS32;
+} map_reference;
+
+static drwav_bool32 load_map_reference(const drwav_uint8* pFileData, size_t fileSize, map_reference* pReference)
+{
+    buffer_stream stream;
+    drwav wav;
+    drwav_uint64 frameCount;
+
+    stream.pData    = pFileData;
+    stream.dataSize = fileSize;
+    stream.cursor   = 0;
+
+    if (!drwav_init(&wav, buffer_stream_read, buffer_stream_seek, buffer_stream_tell, &stream, NULL)) {
+        return DRWAV_FALSE;
+    }
+
+    frameCount = wav.totalPCMFrameCount;
+
+    pReference->frameCount    = frameCount;
+    pReference->bytesPerFrame = drwav_get_bytes_per_pcm_frame(&wav);
+    pReference->channels      = wav.channels;
+    pReference->pRaw          = (drwav_uint8*)malloc((size_t)(frameCount * pReference->bytesPerFrame));
+    pReference->pS16          = (drwav_int16*)malloc((size_t)(frameCount * wav.channels * sizeof(drwav_int16)));
+    pReference->pF32          = (float*      )malloc((size_t)(frameCount * wav.channels * sizeof(float)));
+    pReference->pS32          = (drwav_int32*)malloc((size_t)(frameCount * wav.channels * sizeof(drwav_int32)));
+
+    if (                                       drwav_read_pcm_frames    (&wav, frameCount, pReference->pRaw) != frameCount ||
+        !drwav_seek_to_pcm_frame(&wav, 0) || drwav_read_pcm_frames_s16(&wav, frameCount, pReference->pS16) != frameCount ||
+        !drwav_seek_to_pcm_frame(&wav, 0) || drwav_read_pcm_frames_f32(&wav, frameCount, pReference->pF32) != frameCount ||
+        !drwav_seek_to_pcm_frame(&wav, 0) || drwav_read_pcm_frames_s32(&wav, frameCount, pReference->pS32) != frameCount) {
+        drwav_uninit(&wav);
+        return DRWAV_FALSE;
+    }
+
+    drwav_uninit(&wav);
+    return DRWAV_TRUE;
+}
+
+static void free_map_reference(map_reference* pReference)
+{
+    free(pReference->pRaw);
+    free(pReference->pS16);
+    free(pReference->pF32);
+    free(pReference->pS32);
+}
+
+/* A random number of frames to process at a time, capped to the number that are remaining. */
+static drwav_uint64 random_chunk_size(drwav_uint64 framesRemaining)
+{
+    drwav_uint64 chunkSize = (drwav_uint64)dr_rand_range_s32(1, 300);
+    return (chunkSize < framesRemaining) ? chunkSize : framesRemaining;
+}
+
+/*
+Maps and reads in alternating chunks of random sizes so the read cursor has to be kept in sync between the two, then checks each
+of the conversion routines which will go through the mapped path where the data is suitably aligned and the copy path otherwise.
+*/
+static drwav_bool32 compare_against_map_reference(drwav* pWav, const map_reference* pReference)
+{
+    drwav_uint8* pRaw = (drwav_uint8*)malloc((size_t)(pReference->frameCount * pReference->bytesPerFrame));
+    drwav_int16* pS16 = (drwav_int16*)malloc((size_t)(pReference->frameCount * pReference->channels * sizeof(drwav_int16)));
+    float*       pF32 = (float*      )malloc((size_t)(pReference->frameCount * pReference->channels * sizeof(float)));
+    drwav_int32* pS32 = (drwav_int32*)malloc((size_t)(pReference->frameCount * pReference->channels * sizeof(drwav_int32)));
+    drwav_bool32 result = DRWAV_FALSE;
+    drwav_uint64 frameCount = 0;
+    drwav_bool32 useMap = DRWAV_TRUE;
+
+    while (frameCount < pReference->frameCount) {
+        drwav_uint64 framesToRead = random_chunk_size(pReference->frameCount - frameCount);
+        drwav_uint64 framesRead;
+
+        if (useMap) {
+            const void* pMappedFrames;
+
+            framesRead = drwav_map_pcm_frames(pWav, framesToRead, &pMappedFrames);
+
+            /* Mapping is only possible when the data is already in native byte order. */
+            if (!drwav__is_little_endian()) {
+                if (framesRead != 0 || pMappedFrames != NULL) {
+                    printf("  [Map] Expecting mapping to be unsupported on big-endian");
+                    goto done;
+                }
+
+                framesRead = drwav_read_pcm_frames(pWav, framesToRead, pRaw + (frameCount * pReference->bytesPerFrame));
+            } else {
+                if (pMappedFrames == NULL) {
+                    printf("  [Map] Failed to map PCM frame %d", (int)frameCount);
+                    goto done;
+                }
+
+                memcpy(pRaw + (frameCount * pReference->bytesPerFrame), pMappedFrames, (size_t)(framesRead * pReference->bytesPerFrame));
+            }
+        } else {
+            framesRead = drwav_read_pcm_frames(pWav, framesToRead, pRaw + (frameCount * pReference->bytesPerFrame));
+        }
+
+        if (framesRead != framesToRead) {
+            printf("  [Map] Expecting %d PCM frames at %d, but got %d", (int)framesToRead, (int)frameCount, (int)framesRead);
+            goto done;
+        }
+
+        frameCount += framesRead;
+        useMap = !useMap;
+
+        {
+            drwav_uint64 cursor;
+            if (drwav_get_cursor_in_pcm_frames(pWav, &cursor) != DRWAV_SUCCESS || cursor != frameCount) {
+                printf("  [Map] Expecting the cursor to be at PCM frame %d", (int)frameCount);
+                goto done;
+            }
+        }
+    }
+
+    if (memcmp(pRaw, pReference->pRaw, (size_t)(pReference->frameCount * pReference->bytesPerFrame)) != 0) {
+        printf("  [Map] PCM frames differ");
+        goto done;
+    }
+
+    /* Nothing should be left to map once everything has been consumed. */
+    {
+        const void* pMappedFrames;
+        if (drwav_map_pcm_frames(pWav, 1, &pMappedFrames) != 0 || pMappedFrames != NULL) {
+            printf("  [Map] Expecting nothing to map at the end");
+            goto done;
+        }
+    }
+
+    for (frameCount = 0; frameCount < pReference->frameCount; ) {
+        drwav_uint64 framesToRead = random_chunk_size(pReference->frameCount - frameCount);
+        if (frameCount == 0 && !drwav_seek_to_pcm_frame(pWav, 0)) {
+            printf("  [s16] Failed to seek");
+            goto done;
+        }
+        if (drwav_read_pcm_frames_s16(pWav, framesToRead, pS16 + (frameCount * pReference->channels)) != framesToRead) {
+            printf("  [s16] Failed to read PCM frame %d", (int)frameCount);
+            goto done;
+        }
+        frameCount += framesToRead;
+    }
+
+    if (memcmp(pS16, pReference->pS16, (size_t)(pReference->frameCount * pReference->channels * sizeof(drwav_int16))) != 0) {
+        printf("  [s16] PCM frames differ");
+        goto done;
+    }
+
+    for (frameCount = 0; frameCount < pReference->frameCount; ) {
+        drwav_uint64 framesToRead = random_chunk_size(pReference->frameCount - frameCount);
+        if (frameCount == 0 && !drwav_seek_to_pcm_frame(pWav, 0)) {
+            printf("  [f32] Failed to seek");
+            goto done;
+        }
+        if (drwav_read_pcm_frames_f32(pWav, framesToRead, pF32 + (frameCount * pReference->channels)) != framesToRead) {
+            printf("  [f32] Failed to read PCM frame %d", (int)frameCount);
+            goto done;
+        }
+        frameCount += framesToRead;
+    }
+
+    if (memcmp(pF32, pReference->pF32, (size_t)(pReference->frameCount * pReference->channels * sizeof(float))) != 0) {
+        printf("  [f32] PCM frames differ");
+        goto done;
+    }
+
+    for (frameCount = 0; frameCount < pReference->frameCount; ) {
+        drwav_uint64 framesToRead = random_chunk_size(pReference->frameCount - frameCount);
+        if (frameCount == 0 && !drwav_seek_to_pcm_frame(pWav, 0)) {
+            printf("  [s32] Failed to seek");
+            goto done;
+        }
+        if (drwav_read_pcm_frames_s32(pWav, framesToRead, pS32 + (frameCount * pReference->channels)) != framesToRead) {
+            printf("  [s32] Failed to read PCM frame %d", (int)frameCount);
+            goto done;
+        }
+        frameCount += framesToRead;
+    }
+
+    if (memcmp(pS32, pReference->pS32, (size_t)(pReference->frameCount * pReference->channels * sizeof(drwav_int32))) != 0) {
+        printf("  [s32] PCM frames differ");
+        goto done;
+    }
+
+    result = DRWAV_TRUE;
+
+done:
+    free(pRaw);
+    free(pS16);
+    free(pF32);
+    free(pS32);
+    return result;
+}
+
+static drwav_uint8* generate_pcm_data(drwav_uint16 formatTag, drwav_uint16 bitsPerSample, size_t sampleCount, size_t* pDataSize)
+{
+    size_t dataSize = sampleCount * (bitsPerSample / 8);
+    drwav_uint8* pData = (drwav_uint8*)malloc(dataSize);
+    size_t iSample;
+
+    /* Random bit patterns for floating point data would give NaNs so generate something sensible, including a bit of clipping. */
+    if (formatTag == DR_WAVE_FORMAT_IEEE_FLOAT && bitsPerSample == 32) {
+        for (iSample = 0; iSample < sampleCount; iSample += 1) {
+            float value = dr_rand_range_f32(-1.5f, 1.5f);
+            memcpy(pData + iSample*4, &value, 4);
+        }
+    } else if (formatTag == DR_WAVE_FORMAT_IEEE_FLOAT && bitsPerSample == 64) {
+        for (iSample = 0; iSample < sampleCount; iSample += 1) {
+            double value = dr_rand_range_f32(-1.5f, 1.5f);
+            memcpy(pData + iSample*8, &value, 8);
+        }
+    } else {
+        for (iSample = 0; iSample < dataSize; iSample += 1) {
+            pData[iSample] = (drwav_uint8)dr_rand_range_s32(0, 255);
+        }
+    }
+
+    *pDataSize = dataSize;
+    return pData;
+}
+
+static drwav_bool32 write_file(const char* pFilePath, const void* pData, size_t dataSize)
+{
+    FILE* pFile = fopen(pFilePath, "wb");
+    drwav_bool32 result;
+
+    if (pFile == NULL) {
+        return DRWAV_FALSE;
+    }
+
+    result = fwrite(pData, 1, dataSize, pFile) == dataSize;
+    fclose(pFile);
+
+    return result;
+}
+
+drwav_result test_map_case(const char* pName, drwav_uint16 formatTag, drwav_uint16 bitsPerSample, drwav_uint16 channels)
+{
+    drwav_result result = DRWAV_SUCCESS;
+    drwav_uint8* pSampleData;
+    size_t sampleDataSize;
+    drwav_uint32 junkSize;
+
+    dr_printf_fixed_with_margin(TABLE_WIDTH, TABLE_MARGIN, "%s", pName);
+
+    pSampleData = generate_pcm_data(formatTag, bitsPerSample, (size_t)dr_rand_range_s32(1000, 1100) * channels, &sampleDataSize);
+
+    /*
+    Without a JUNK chunk the sample data starts at offset 46 which is not aligned for 4 and 8 byte samples. A 2 byte JUNK chunk moves
+    it to offset 56 which is. The memory decoders also move the file itself around so that every alignment is covered.
+    */
+    for (junkSize = 0; junkSize <= 2 && result == DRWAV_SUCCESS; junkSize += 2) {
+        drwav_uint8* pFileData;
+        size_t fileSize;
+        map_reference reference;
+        drwav_uint8* pMisalignedBuffer;
+        size_t misalignment;
+        drwav wav;
+
+        pFileData = build_wav(formatTag, channels, bitsPerSample, (drwav_uint16)(channels * bitsPerSample / 8), NULL, 0, junkSize, pSampleData, sampleDataSize, &fileSize);
+
+        if (!load_map_reference(pFileData, fileSize, &reference)) {
+            free(pFileData);
+            printf("  Failed to load reference\n");
+            result = DRWAV_ERROR;
+            break;
+        }
+
+        pMisalignedBuffer = (drwav_uint8*)malloc(fileSize + 8);
+
+        for (misalignment = 0; misalignment < 8 && result == DRWAV_SUCCESS; misalignment += 1) {
+            memcpy(pMisalignedBuffer + misalignment, pFileData, fileSize);
+
+            if (!drwav_init_memory(&wav, pMisalignedBuffer + misalignment, fileSize, NULL)) {
+                printf("  Failed to open from memory");
+                result = DRWAV_ERROR;
+            } else {
+                if (!compare_against_map_reference(&wav, &reference)) {
+                    printf(" (memory, offset %d)", (int)misalignment);
+                    result = DRWAV_ERROR;
+                }
+                drwav_uninit(&wav);
+            }
+        }
+
+    #ifdef DRWAV_HAS_MMAP
+        if (result == DRWAV_SUCCESS) {
+            if (!write_file("wav_consistency.wav", pFileData, fileSize)) {
+                printf("  Failed to write wav_consistency.wav");
+                result = DRWAV_ERROR;
+            }
+
+            if (result == DRWAV_SUCCESS) {
+                if (!drwav_init_file_mmap(&wav, "wav_consistency.wav", NULL)) {
+                    printf("  Failed to open with drwav_init_file_mmap()");
+                    result = DRWAV_ERROR;
+                } else {
+                    if (!compare_against_map_reference(&wav, &reference)) {
+                        printf(" (mmap)");
+                        result = DRWAV_ERROR;
+                    }
+                    drwav_uninit(&wav);
+                }
+            }
+
+        #ifndef DR_WAV_NO_WCHAR
+            if (result == DRWAV_SUCCESS) {
+                if (!drwav_init_file_mmap_w(&wav, L"wav_consistency.wav", NULL)) {
+                    printf("  Failed to open with drwav_init_file_mmap_w()");
+                    result = DRWAV_ERROR;
+                } else {
+                    if (!compare_against_map_reference(&wav, &reference)) {
+                        printf(" (mmap_w)");
+                        result = DRWAV_ERROR;
+                    }
+                    drwav_uninit(&wav);
+                }
+            }
+        #endif
+
+            remove("wav_consistency.wav");
+        }
+    #endif
+
+        free(pMisalignedBuffer);
+        free_map_reference(&reference);
+        free(pFileData);
+    }
+
+    if (result == DRWAV_SUCCESS) {
+        printf("  Passed\n");
+    } else {
+        printf("\n");
+    }
+
+    free(pSampleData);
+    return result;
+}
+
+drwav_result test_map(void)
+{
+    static const struct
+    {
+        const char* pName;
+        drwav_uint16 formatTag;
+        drwav_uint16 bitsPerSample;
+        drwav_uint16 channels;
+    } cases[] = {
+        { "Map u8 mono",       DR_WAVE_FORMAT_PCM,        8,  1 },
+        { "Map u8 stereo",     DR_WAVE_FORMAT_PCM,        8,  2 },
+        { "Map s16 mono",      DR_WAVE_FORMAT_PCM,        16, 1 },
+        { "Map s16 stereo",    DR_WAVE_FORMAT_PCM,        16, 2 },
+        { "Map s24 mono",      DR_WAVE_FORMAT_PCM,        24, 1 },
+        { "Map s24 stereo",    DR_WAVE_FORMAT_PCM,        24, 2 },
+        { "Map s32 mono",      DR_WAVE_FORMAT_PCM,        32, 1 },
+        { "Map s32 stereo",    DR_WAVE_FORMAT_PCM,        32, 2 },
+        { "Map f32 mono",      DR_WAVE_FORMAT_IEEE_FLOAT, 32, 1 },
+        { "Map f32 stereo",    DR_WAVE_FORMAT_IEEE_FLOAT, 32, 2 },
+        { "Map f64 mono",      DR_WAVE_FORMAT_IEEE_FLOAT, 64, 1 },
+        { "Map f64 stereo",    DR_WAVE_FORMAT_IEEE_FLOAT, 64, 2 },
+        { "Map A-law mono",    DR_WAVE_FORMAT_ALAW,       8,  1 },
+        { "Map A-law stereo",  DR_WAVE_FORMAT_ALAW,       8,  2 },
+        { "Map mu-law mono",   DR_WAVE_FORMAT_MULAW,      8,  1 },
+        { "Map mu-law stereo", DR_WAVE_FORMAT_MULAW,      8,  2 }
+    };
+
+    drwav_result result = DRWAV_SUCCESS;
+    size_t iCase;
+    drwav_uint8* pFileData;
+    size_t fileSize;
+    drwav wav;
+
+    for (iCase = 0; iCase < drwav_countof(cases); iCase += 1) {
+        if (test_map_case(cases[iCase].pName, cases[iCase].formatTag, cases[iCase].bitsPerSample, cases[iCase].channels) != DRWAV_SUCCESS) {
+            result = DRWAV_ERROR;
+        }
+    }
+
+    /* Compressed formats can't be mapped, even from memory. */
+    dr_printf_fixed_with_margin(TABLE_WIDTH, TABLE_MARGIN, "%s", "Map ADPCM");
+    pFileData = build_adpcm_wav(DR_WAVE_FORMAT_DVI_ADPCM, 2, 1024, 4, 0, &fileSize);
+    if (!drwav_init_memory(&wav, pFileData, fileSize, NULL)) {
+        printf("  Failed to open\n");
+        result = DRWAV_ERROR;
+    } else {
+        const void* pMappedFrames = &wav;
+
+        if (drwav_map_pcm_frames(&wav, 16, &pMappedFrames) != 0 || pMappedFrames != NULL || wav.readCursorInPCMFrames != 0) {
+            printf("  Expecting mapping to be unsupported\n");
+            result = DRWAV_ERROR;
+        } else {
+            printf("  Passed\n");
+        }
+
+        drwav_uninit(&wav);
+    }
+    free(pFileData);
+
+    return result;
+}
+
+/*
+The conversion routines all have different signatures so they're wrapped up in a common one. The __scalar variants are what gets
+compiled when DR_WAV_NO_SIMD is defined so they are used as the reference.
+*/
+typedef void (* conversion_proc)(void* pOut, const void* pIn, size_t sampleCount);
+
+#define DEFINE_CONVERSION_PROC(proc, outType, inType) \
+    static void proc##__generic(void* pOut, const void* pIn, size_t sampleCount) { proc((outType*)pOut, (const inType*)pIn, sampleCount); }
+
+#define DEFINE_CONVERSION_PROCS(suffix) \
+    DEFINE_CONVERSION_PROC(drwav_u8_to_s16##suffix,  drwav_int16, drwav_uint8) \
+    DEFINE_CONVERSION_PROC(drwav_s24_to_s16##suffix, drwav_int16, drwav_uint8) \
+    DEFINE_CONVERSION_PROC(drwav_s32_to_s16##suffix, drwav_int16, drwav_int32) \
+    DEFINE_CONVERSION_PROC(drwav_f32_to_s16##suffix, drwav_int16, float)       \
+    DEFINE_CONVERSION_PROC(drwav_s16_to_f32##suffix, float,       drwav_int16) \
+    DEFINE_CONVERSION_PROC(drwav_s24_to_f32##suffix, float,       drwav_uint8) \
+    DEFINE_CONVERSION_PROC(drwav_s32_to_f32##suffix, float,       drwav_int32) \
+    DEFINE_CONVERSION_PROC(drwav_u8_to_s32##suffix,  drwav_int32, drwav_uint8) \
+    DEFINE_CONVERSION_PROC(drwav_s16_to_s32##suffix, drwav_int32, drwav_int16) \
+    DEFINE_CONVERSION_PROC(drwav_s24_to_s32##suffix, drwav_int32, drwav_uint8) \
+    DEFINE_CONVERSION_PROC(drwav_f32_to_s32##suffix, drwav_int32, float)
+
+DEFINE_CONVERSION_PROC(drwav_u8_to_s16,  drwav_int16, drwav_uint8)
+DEFINE_CONVERSION_PROC(drwav_s24_to_s16, drwav_int16, drwav_uint8)
+DEFINE_CONVERSION_PROC(drwav_s32_to_s16, drwav_int16, drwav_int32)
+DEFINE_CONVERSION_PROC(drwav_f32_to_s16, drwav_int16, float)
+DEFINE_CONVERSION_PROC(drwav_s16_to_f32, float,       drwav_int16)
+DEFINE_CONVERSION_PROC(drwav_s24_to_f32, float,       drwav_uint8)
+DEFINE_CONVERSION_PROC(drwav_s32_to_f32, float,       drwav_int32)
+DEFINE_CONVERSION_PROC(drwav_u8_to_s32,  drwav_int32, drwav_uint8)
+DEFINE_CONVERSION_PROC(drwav_s16_to_s32, drwav_int32, drwav_int16)
+DEFINE_CONVERSION_PROC(drwav_s24_to_s32, drwav_int32, drwav_uint8)
+DEFINE_CONVERSION_PROC(drwav_f32_to_s32, drwav_int32, float)
+
+DEFINE_CONVERSION_PROCS(__scalar)
+
+#if defined(DRWAV_SUPPORT_SSE2)
+DEFINE_CONVERSION_PROCS(__sse2)
+#define SSE2_CONVERSION_PROC(proc) proc##__sse2__generic
+#else
+#define SSE2_CONVERSION_PROC(proc) NULL
+#endif
+
+#if defined(DRWAV_SUPPORT_AVX2)
+DEFINE_CONVERSION_PROCS(__avx2)
+#define AVX2_CONVERSION_PROC(proc) proc##__avx2__generic
+#else
+#define AVX2_CONVERSION_PROC(proc) NULL
+#endif
+
+#if defined(DRWAV_SUPPORT_NEON)
+DEFINE_CONVERSION_PROCS(__neon)
+#define NEON_CONVERSION_PROC(proc) proc##__neon__generic
+#else
+#define NEON_CONVERSION_PROC(proc) NULL
+#endif
+
+#define CONVERSION_PROCS(proc) proc##__generic, proc##__scalar__generic, SSE2_CONVERSION_PROC(proc), AVX2_CONVERSION_PROC(proc), NEON_CONVERSION_PROC(proc)
+
+typedef enum
+{
+    conversion_input_bits,          /* Any bit pattern is valid. */
+    conversion_input_f32_clipped,   /* Floats that go a bit beyond -1..1 so the clipping gets tested. */
+    conversion_input_f32_unit       /* Floats in -1..1 (exclusive of 1). Anything else is undefined for the scalar f32 to s32 conversion. */
+} conversion_input;
+
+#define MAX_CONVERSION_SAMPLE_COUNT 67
+#define MAX_CONVERSION_OFFSET       8   /* In samples. */
+
+static void generate_conversion_input(drwav_uint8* pIn, conversion_input input, size_t sampleCount)
+{
+    static const float edgeCases[] = { -1.0f, -0.0f, 0.0f, 1.0f, 0.99999994f, -0.99999994f, 1.5f, -1.5f };
+    size_t iSample;
+
+    if (input == conversion_input_bits) {
+        for (iSample = 0; iSample < sampleCount; iSample += 1) {
+            pIn[iSample] = (drwav_uint8)dr_rand_range_s32(0, 255);
+        }
+    } else {
+        float* pInF32 = (float*)pIn;
+
+        for (iSample = 0; iSample < sampleCount; iSample += 1) {
+            if (dr_rand_range_s32(0, 7) == 0) {
+                pInF32[iSample] = edgeCases[dr_rand_range_s32(0, (input == conversion_input_f32_clipped) ? 7 : 5)];
+            } else if (input == conversion_input_f32_clipped) {
+                pInF32[iSample] = dr_rand_range_f32(-1.5f, 1.5f);
+            } else {
+                pInF32[iSample] = dr_rand_range_f32(-1, 0.99999994f);
+            }
+        }
+    }
+}
+
+drwav_result test_conversion_case(const char* pName, conversion_input input, size_t inputBytesPerSample, size_t outputBytesPerSample, conversion_proc onPublic, conversion_proc onScalar, conversion_proc onSSE2, conversion_proc onAVX2, conversion_proc onNEON)
+{
+    drwav_result result = DRWAV_SUCCESS;
+    size_t inputBufferSize  = (MAX_CONVERSION_SAMPLE_COUNT + MAX_CONVERSION_OFFSET) * inputBytesPerSample;
+    size_t outputBufferSize = (MAX_CONVERSION_SAMPLE_COUNT + MAX_CONVERSION_OFFSET*2) * outputBytesPerSample;
+    drwav_uint8* pIn        = (drwav_uint8*)malloc(inputBufferSize);
+    drwav_uint8* pExpected  = (drwav_uint8*)malloc(outputBufferSize);
+    drwav_uint8* pActual    = (drwav_uint8*)malloc(outputBufferSize);
+    conversion_proc procs[4];
+    const char* procNames[4];
+    size_t procCount = 0;
+    size_t sampleCount;
+    size_t inputOffset;
+    size_t outputOffset;
+    size_t iProc;
+
+    dr_printf_fixed_with_margin(TABLE_WIDTH, TABLE_MARGIN, "%s", pName);
+
+    procs[procCount] = onPublic; procNames[procCount] = "public"; procCount += 1;
+    if (onSSE2 != NULL && drwav__gIsSSE2Supported) { procs[procCount] = onSSE2; procNames[procCount] = "SSE2"; procCount += 1; }
+    if (onAVX2 != NULL && drwav__gIsAVX2Supported) { procs[procCount] = onAVX2; procNames[procCount] = "AVX2"; procCount += 1; }
+    if (onNEON != NULL && drwav__gIsNEONSupported) { procs[procCount] = onNEON; procNames[procCount] = "NEON"; procCount += 1; }
+
+    /* Every length up to a few multiples of the widest vector, at every alignment. The output canaries catch out of bounds writes. */
+    for (sampleCount = 0; sampleCount <= MAX_CONVERSION_SAMPLE_COUNT && result == DRWAV_SUCCESS; sampleCount += 1) {
+        for (inputOffset = 0; inputOffset < MAX_CONVERSION_OFFSET && result == DRWAV_SUCCESS; inputOffset += 1) {
+            for (outputOffset = 0; outputOffset < MAX_CONVERSION_OFFSET && result == DRWAV_SUCCESS; outputOffset += 1) {
+                const drwav_uint8* pInput = pIn + (inputOffset * inputBytesPerSample);
+
+                generate_conversion_input(pIn, input, (input == conversion_input_bits) ? inputBufferSize : inputBufferSize / sizeof(float));
+
+                memset(pExpected, 0xCD, outputBufferSize);
+                onScalar(pExpected + (outputOffset * outputBytesPerSample), pInput, sampleCount);
+
+                for (iProc = 0; iProc < procCount; iProc += 1) {
+                    memset(pActual, 0xCD, outputBufferSize);
+                    procs[iProc](pActual + (outputOffset * outputBytesPerSample), pInput, sampleCount);
+
+                    if (memcmp(pActual, pExpected, outputBufferSize) != 0) {
+                        printf("  [%s] Output differs with %d samples, input offset %d and output offset %d\n", procNames[iProc], (int)sampleCount, (int)inputOffset, (int)outputOffset);
+                        result = DRWAV_ERROR;
+                        break;
+                    }
+                }
+            }
+        }
+    }
+
+    if (result == DRWAV_SUCCESS) {
+        printf("  Passed (");
+        for (iProc = 0; iProc < procCount; iProc += 1) {
+            printf((iProc == 0) ? "%s" : ", %s", procNames[iProc]);
+        }
+        printf(")\n");
+    }
+
+    free(pIn);
+    free(pExpected);
+    free(pActual);
+    return result;
+}
+
+drwav_result test_conversion(void)
+{
+    static const struct
+    {
+        const char* pName;
+        conversion_input input;
+        size_t inputBytesPerSample;
+        size_t outputBytesPerSample;
+        conversion_proc onPublic;
+        conversion_proc onScalar;
+        conversion_proc onSSE2;
+        conversion_proc onAVX2;
+        conversion_proc onNEON;
+    } cases[] = {
+        { "drwav_u8_to_s16",  conversion_input_bits,        1, 2, CONVERSION_PROCS(drwav_u8_to_s16)  },
+        { "drwav_s24_to_s16", conversion_input_bits,        3, 2, CONVERSION_PROCS(drwav_s24_to_s16) },
+        { "drwav_s32_to_s16", conversion_input_bits,        4, 2, CONVERSION_PROCS(drwav_s32_to_s16) },
+        { "drwav_f32_to_s16", conversion_input_f32_clipped, 4, 2, CONVERSION_PROCS(drwav_f32_to_s16) },
+        { "drwav_s16_to_f32", conversion_input_bits,        2, 4, CONVERSION_PROCS(drwav_s16_to_f32) },
+        { "drwav_s24_to_f32", conversion_input_bits,        3, 4, CONVERSION_PROCS(drwav_s24_to_f32) },
+        { "drwav_s32_to_f32", conversion_input_bits,        4, 4, CONVERSION_PROCS(drwav_s32_to_f32) },
+        { "drwav_u8_to_s32",  conversion_input_bits,        1, 4, CONVERSION_PROCS(drwav_u8_to_s32)  },
+        { "drwav_s16_to_s32", conversion_input_bits,        2, 4, CONVERSION_PROCS(drwav_s16_to_s32) },
+        { "drwav_s24_to_s32", conversion_input_bits,        3, 4, CONVERSION_PROCS(drwav_s24_to_s32) },
+        { "drwav_f32_to_s32", conversion_input_f32_unit,    4, 4, CONVERSION_PROCS(drwav_f32_to_s32) }
+    };
+
+    drwav_result result = DRWAV_SUCCESS;
+    size_t iCase;
+
+    /* The SIMD variants are only tested when the CPU supports them. The public function takes care of this itself. */
+    drwav__init_cpu_caps();
+
+    for (iCase = 0; iCase < drwav_countof(cases); iCase += 1) {
+        if (test_conversion_case(cases[iCase].pName, cases[iCase].input, cases[iCase].inputBytesPerSample, cases[iCase].outputBytesPerSample, cases[iCase].onPublic, cases[iCase].onScalar, cases[iCase].onSSE2, cases[iCase].onAVX2, cases[iCase].onNEON) != DRWAV_SUCCESS) {
+            result = DRWAV_ERROR;
+        }
+    }
+
+    return result;
+}
+
+int main(int argc, char** argv)
+{
+    drwav_bool32 hasError = DRWAV_FALSE;
+
+    (void)argc;
+    (void)argv;
+
+    dr_seed(1234);
+
+    if (test_adpcm_seek() != DRWAV_SUCCESS) {
+        hasError = DRWAV_TRUE;
+    }
+
+    if (test_map() != DRWAV_SUCCESS) {
+        hasError = DRWAV_TRUE;
+    }
+
+    if (test_conversion() != DRWAV_SUCCESS) {
+        hasError = DRWAV_TRUE;
+    }
+
+    return hasError ? 1 : 0;
+}